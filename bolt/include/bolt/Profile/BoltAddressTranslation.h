@@ -39,6 +39,11 @@ class BinaryFunction;
 /// optimized. The goal is to avoid special deployments of non-bolted binaries
 /// just for the purposes of data collection.
 ///
+/// Refreshing the optimization as the workload changes is thus a loop: profile
+/// the deployed binary, translate the samples with this map, and run BOLT on
+/// the original input again. Each run is a full rewrite, but in lite mode only
+/// the functions with a profile are optimized, which bounds the cost of a run.
+///
 /// The in-memory representation of the map is as follows. Each function has its
 /// own map. A function is identified by its output address. This is the key to
 /// retrieve a translation map. The translation map is a collection of ordered
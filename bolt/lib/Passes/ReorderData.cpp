@@ -16,6 +16,7 @@
 // - estimate temporal locality by looking at CFG?
 
 #include "bolt/Passes/ReorderData.h"
+#include "llvm/ADT/DenseSet.h"
 #include "llvm/ADT/MapVector.h"
 #include <algorithm>
 
@@ -100,6 +101,18 @@ namespace {
 
 static constexpr uint16_t MinAlignment = 16;
 
+/// The cache line size assumed for reporting data locality.
+static constexpr uint64_t CacheLineSize = 64;
+
+/// Add the cache lines covered by \p Size bytes at \p Address to \p Lines.
+void addCacheLines(DenseSet<uint64_t> &Lines, uint64_t Address,
+                   uint64_t Size) {
+  const uint64_t Last = Address + std::max<uint64_t>(Size, 1) - 1;
+  for (uint64_t Line = Address / CacheLineSize; Line <= Last / CacheLineSize;
+       ++Line)
+    Lines.insert(Line);
+}
+
 bool isSupported(const BinarySection &BS) { return BS.isData() && !BS.isTLS(); }
 
 bool filterSymbol(const BinaryData *BD) {
@@ -338,6 +351,9 @@ void ReorderData::setSectionOrder(BinaryContext &BC,
   unsigned NumReordered = 0;
   uint64_t Offset = 0;
   uint64_t Count = 0;
+  // Cache lines touched by the sampled symbols, before and after reordering.
+  DenseSet<uint64_t> OldHotLines;
+  DenseSet<uint64_t> NewHotLines;
 
   // Get the total count just for stats
   uint64_t TotalCount = 0;
@@ -389,6 +405,11 @@ void ReorderData::setSectionOrder(BinaryContext &BC,
       }
     }
 
+    if (Begin->second) {
+      addCacheLines(OldHotLines, BD->getAddress(), BD->getSize());
+      addCacheLines(NewHotLines, Offset, BD->getSize());
+    }
+
     Offset += BD->getSize();
     Count += Begin->second;
     NewOrder.push_back(BD);
@@ -399,6 +420,9 @@ void ReorderData::setSectionOrder(BinaryContext &BC,
   BC.outs() << "BOLT-INFO: reorder-data: " << Count << "/" << TotalCount
             << format(" (%.1f%%)", 100.0 * Count / TotalCount) << " events, "
             << Offset << " hot bytes\n";
+  BC.outs() << "BOLT-INFO: reorder-data: sampled data spans "
+            << NewHotLines.size() << " cache lines (" << OldHotLines.size()
+            << " before reordering)\n";
 }
 
 bool ReorderData::markUnmoveableSymbols(BinaryContext &BC,
@@ -170,6 +170,11 @@ void DataAggregator::start() {
 
   findPerfExecutable();
 
+  // Every job below has perf decode the whole input and format it as text,
+  // which dominates the aggregation time for large inputs. The jobs run
+  // concurrently, and the decoding can't be shared between them. Profiles that
+  // are used repeatedly are better converted once into the pre-aggregated
+  // format, which skips perf entirely.
   if (opts::BasicAggregation) {
     launchPerfProcess("events without LBR",
                       MainEventsPPI,
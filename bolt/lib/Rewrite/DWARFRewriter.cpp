@@ -790,6 +790,10 @@ void DWARFRewriter::updateDebugInfo() {
       createDIEStreamer(*TheTriple, *ObjOS, "TypeStreamer", DIEBlder, *this);
   CUOffsetMap OffsetMap = finalizeTypeSections(DIEBlder, *Streamer);
 
+  // CUs are rewritten one batch of --cu-processing-batch-size units at a time,
+  // so the DIE state held at once is bounded by the batch. The rewritten
+  // sections themselves are accumulated in memory, as BOLT writes every output
+  // section from its contents once the whole file has been laid out.
   const bool SingleThreadedMode =
       opts::NoThreads || opts::DeterministicDebugInfo;
   if (!SingleThreadedMode)
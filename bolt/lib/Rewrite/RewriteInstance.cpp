@@ -3423,6 +3423,11 @@ void RewriteInstance::emitAndLink() {
     }
   }
 
+  // All functions are emitted through this one streamer into a single object.
+  // Symbols, fixups and sections all live in BC's MCContext, and a function
+  // may reference any other function's labels, so emission can't be split
+  // across threads without giving each its own context and resolving the
+  // cross references when the pieces are linked.
   emitBinaryContext(*Streamer, *BC, getOrgSecPrefix());
 
   Streamer->finish();
@@ -386,39 +386,52 @@ int main(int argc, char **argv) {
   // Merged information for all functions.
   StringMap<BinaryFunctionProfile> MergedBFs;
 
-  for (std::string &InputDataFilename : Inputs) {
-    ErrorOr<std::unique_ptr<MemoryBuffer>> MB =
-        MemoryBuffer::getFileOrSTDIN(InputDataFilename);
-    if (std::error_code EC = MB.getError())
-      report_error(InputDataFilename, EC);
-    yaml::Input YamlInput(MB.get()->getBuffer());
-
-    errs() << "Merging data from " << InputDataFilename << "...\n";
-
-    BinaryProfile BP;
-    YamlInput >> BP;
-    if (YamlInput.error())
-      report_error(InputDataFilename, YamlInput.error());
-
-    // Sanity check.
-    if (BP.Header.Version != 1) {
-      errs() << "Unable to merge data from profile using version "
-             << BP.Header.Version << '\n';
-      exit(1);
+  // Parse the inputs in parallel, a window of inputs at a time to bound the
+  // memory taken by parsed profiles, then merge each window in input order so
+  // that the result does not depend on scheduling.
+  DefaultThreadPool Pool;
+  const size_t WindowSize = Pool.getMaxConcurrency();
+  for (size_t Begin = 0; Begin < Inputs.size(); Begin += WindowSize) {
+    const size_t End = std::min(Begin + WindowSize, Inputs.size());
+    std::vector<BinaryProfile> Profiles(End - Begin);
+    std::vector<std::error_code> Errors(End - Begin);
+    for (size_t I = Begin; I < End; ++I) {
+      Pool.async([&, I] {
+        ErrorOr<std::unique_ptr<MemoryBuffer>> MB =
+            MemoryBuffer::getFileOrSTDIN(Inputs[I]);
+        if ((Errors[I - Begin] = MB.getError()))
+          return;
+        yaml::Input YamlInput(MB.get()->getBuffer());
+        YamlInput >> Profiles[I - Begin];
+        Errors[I - Begin] = YamlInput.error();
+      });
     }
+    Pool.wait();
+
+    for (size_t I = Begin; I < End; ++I) {
+      errs() << "Merging data from " << Inputs[I] << "...\n";
+      if (std::error_code EC = Errors[I - Begin])
+        report_error(Inputs[I], EC);
+
+      BinaryProfile &BP = Profiles[I - Begin];
+      // Sanity check.
+      if (BP.Header.Version != 1) {
+        errs() << "Unable to merge data from profile using version "
+               << BP.Header.Version << '\n';
+        exit(1);
+      }
 
-    // Merge the header.
-    mergeProfileHeaders(MergedHeader, BP.Header);
+      // Merge the header.
+      mergeProfileHeaders(MergedHeader, BP.Header);
 
-    // Do the function merge.
-    for (BinaryFunctionProfile &BF : BP.Functions) {
-      if (!MergedBFs.count(BF.Name)) {
-        MergedBFs.insert(std::make_pair(BF.Name, BF));
-        continue;
+      // Do the function merge.
+      for (BinaryFunctionProfile &BF : BP.Functions) {
+        auto [It, Inserted] = MergedBFs.try_emplace(BF.Name);
+        if (Inserted)
+          It->second = std::move(BF);
+        else
+          mergeFunctionProfile(It->second, std::move(BF));
       }
-
-      BinaryFunctionProfile &MergedBF = MergedBFs.find(BF.Name)->second;
-      mergeFunctionProfile(MergedBF, std::move(BF));
     }
   }
 
@@ -40,6 +40,7 @@
 #include "clang/Tooling/ReplacementsYaml.h"
 #include "clang/Tooling/Tooling.h"
 #include "llvm/Support/Process.h"
+#include "llvm/Support/TimeProfiler.h"
 #include <algorithm>
 #include <utility>
 
@@ -578,8 +579,24 @@ runClangTidy(clang::tidy::ClangTidyContext &Context,
                        DiagnosticConsumer *DiagConsumer) override {
       // Explicitly ask to define __clang_analyzer__ macro.
       Invocation->getPreprocessorOpts().SetUpStaticAnalyzer = true;
-      return FrontendActionFactory::runInvocation(
+
+      // Honor -ftime-trace as the compiler does. The trace then shows the
+      // time spent in each check next to parsing and semantic analysis.
+      const FrontendOptions &FEOpts = Invocation->getFrontendOpts();
+      bool TimeTrace = !FEOpts.TimeTracePath.empty();
+      if (TimeTrace)
+        llvm::timeTraceProfilerInitialize(FEOpts.TimeTraceGranularity,
+                                          "clang-tidy");
+      bool Success = FrontendActionFactory::runInvocation(
           Invocation, Files, PCHContainerOps, DiagConsumer);
+      if (TimeTrace) {
+        if (llvm::Error Err = llvm::timeTraceProfilerWrite(
+                FEOpts.TimeTracePath, FEOpts.Inputs.front().getFile()))
+          llvm::errs() << "Error writing time trace: "
+                       << llvm::toString(std::move(Err)) << "\n";
+        llvm::timeTraceProfilerCleanup();
+      }
+      return Success;
     }
 
   private:
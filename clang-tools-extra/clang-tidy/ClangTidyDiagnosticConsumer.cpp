@@ -741,17 +741,31 @@ struct EqualClangTidyError {
 };
 } // end anonymous namespace
 
-std::vector<ClangTidyError> ClangTidyDiagnosticConsumer::take() {
-  finalizeLastError();
-
+static void sortAndDeduplicateErrors(std::vector<ClangTidyError> &Errors) {
   llvm::stable_sort(Errors, LessClangTidyError());
   Errors.erase(std::unique(Errors.begin(), Errors.end(), EqualClangTidyError()),
                Errors.end());
+}
+
+std::vector<ClangTidyError> ClangTidyDiagnosticConsumer::take() {
+  finalizeLastError();
+
+  sortAndDeduplicateErrors(Errors);
   if (RemoveIncompatibleErrors)
     removeIncompatibleErrors();
   return std::move(Errors);
 }
 
+std::vector<ClangTidyError> clang::tidy::mergeClangTidyErrors(
+    std::vector<std::vector<ClangTidyError>> ErrorSets) {
+  std::vector<ClangTidyError> Errors;
+  for (std::vector<ClangTidyError> &Set : ErrorSets)
+    Errors.insert(Errors.end(), std::make_move_iterator(Set.begin()),
+                  std::make_move_iterator(Set.end()));
+  sortAndDeduplicateErrors(Errors);
+  return Errors;
+}
+
 namespace {
 struct LessClangTidyErrorWithoutDiagnosticName {
   bool operator()(const ClangTidyError *LHS, const ClangTidyError *RHS) const {
@@ -43,6 +43,12 @@ struct ClangTidyError : tooling::Diagnostic {
   std::vector<std::string> EnabledDiagnosticAliases;
 };
 
+/// Merges the errors returned by several clang-tidy runs, sorted as a single
+/// run would return them, and drops the ones reported by more than one run,
+/// e.g. for a header included by the input files of both.
+std::vector<ClangTidyError>
+mergeClangTidyErrors(std::vector<std::vector<ClangTidyError>> ErrorSets);
+
 /// Contains displayed and ignored diagnostic counters for a ClangTidy run.
 struct ClangTidyStats {
   unsigned ErrorsDisplayed = 0;
@@ -25,6 +25,7 @@
 #include "llvm/Support/Process.h"
 #include "llvm/Support/Signals.h"
 #include "llvm/Support/TargetSelect.h"
+#include "llvm/Support/ThreadPool.h"
 #include "llvm/Support/WithColor.h"
 #include <optional>
 
@@ -288,6 +289,15 @@ options are specified.
 )"),
                            cl::init(false), cl::cat(ClangTidyCategory));
 
+static cl::opt<unsigned> Jobs("j", desc(R"(
+Number of input files to check in parallel.
+Each job parses its files with its own copy of
+the checks. Diagnostics in headers shared by
+files of different jobs are reported once.
+)"),
+                            cl::init(1), cl::value_desc("N"),
+                            cl::cat(ClangTidyCategory));
+
 static cl::opt<std::string> VfsOverlay("vfsoverlay", desc(R"(
 Overlay the virtual filesystem described by file
 over the real file system.
@@ -536,9 +546,16 @@ static SmallString<256> makeAbsolute(llvm::StringRef Input) {
   return AbsolutePath;
 }
 
-static llvm::IntrusiveRefCntPtr<vfs::OverlayFileSystem> createBaseFS() {
+/// \param OwnWorkingDirectory Track the working directory in the file system
+/// instead of changing the process's, so that several ClangTools can run at
+/// once.
+static llvm::IntrusiveRefCntPtr<vfs::OverlayFileSystem>
+createBaseFS(bool OwnWorkingDirectory = false) {
+  llvm::IntrusiveRefCntPtr<vfs::FileSystem> RealFS = vfs::getRealFileSystem();
+  if (OwnWorkingDirectory)
+    RealFS = vfs::createPhysicalFileSystem();
   llvm::IntrusiveRefCntPtr<vfs::OverlayFileSystem> BaseFS(
-      new vfs::OverlayFileSystem(vfs::getRealFileSystem()));
+      new vfs::OverlayFileSystem(std::move(RealFS)));
 
   if (!VfsOverlay.empty()) {
     IntrusiveRefCntPtr<vfs::FileSystem> VfsFromFile =
@@ -550,6 +567,51 @@ static llvm::IntrusiveRefCntPtr<vfs::OverlayFileSystem> createBaseFS() {
   return BaseFS;
 }
 
+static void addStats(ClangTidyStats &Total, const ClangTidyStats &Stats) {
+  Total.ErrorsDisplayed += Stats.ErrorsDisplayed;
+  Total.ErrorsIgnoredCheckFilter += Stats.ErrorsIgnoredCheckFilter;
+  Total.ErrorsIgnoredNOLINT += Stats.ErrorsIgnoredNOLINT;
+  Total.ErrorsIgnoredNonUserCode += Stats.ErrorsIgnoredNonUserCode;
+  Total.ErrorsIgnoredLineFilter += Stats.ErrorsIgnoredLineFilter;
+}
+
+/// Checks \p PathList on up to \p Jobs threads. Each thread runs clang-tidy
+/// over a share of the files with its own context, checks and file system.
+static std::vector<ClangTidyError>
+runClangTidyInParallel(const tooling::CompilationDatabase &Compilations,
+                       ArrayRef<std::string> PathList, StringRef ProfilePrefix,
+                       ClangTidyStats &Stats) {
+  unsigned NumJobs = std::min<size_t>(Jobs, PathList.size());
+  std::vector<std::vector<std::string>> Shards(NumJobs);
+  for (size_t I = 0; I < PathList.size(); ++I)
+    Shards[I % NumJobs].push_back(PathList[I]);
+
+  std::vector<std::unique_ptr<ClangTidyContext>> Contexts;
+  std::vector<llvm::IntrusiveRefCntPtr<vfs::OverlayFileSystem>> FileSystems;
+  for (unsigned I = 0; I < NumJobs; ++I) {
+    FileSystems.push_back(createBaseFS(/*OwnWorkingDirectory=*/true));
+    Contexts.push_back(std::make_unique<ClangTidyContext>(
+        createOptionsProvider(FileSystems.back()),
+        AllowEnablingAnalyzerAlphaCheckers, EnableModuleHeadersParsing));
+  }
+
+  std::vector<std::vector<ClangTidyError>> ErrorSets(NumJobs);
+  llvm::DefaultThreadPool Pool(llvm::hardware_concurrency(NumJobs));
+  for (unsigned I = 0; I < NumJobs; ++I)
+    Pool.async([&, I] {
+      ErrorSets[I] =
+          runClangTidy(*Contexts[I], Compilations, Shards[I], FileSystems[I],
+                       FixNotes, EnableCheckProfile, ProfilePrefix);
+    });
+  Pool.wait();
+
+  // As in a single run, a diagnostic in a header is counted once for each
+  // file that includes the header, before duplicates are dropped.
+  for (const auto &Context : Contexts)
+    addStats(Stats, Context->getStats());
+  return mergeClangTidyErrors(std::move(ErrorSets));
+}
+
 int clangTidyMain(int argc, const char **argv) {
   llvm::InitLLVM X(argc, argv);
 
@@ -677,9 +739,16 @@ int clangTidyMain(int argc, const char **argv) {
   ClangTidyContext Context(std::move(OwningOptionsProvider),
                            AllowEnablingAnalyzerAlphaCheckers,
                            EnableModuleHeadersParsing);
-  std::vector<ClangTidyError> Errors =
-      runClangTidy(Context, OptionsParser->getCompilations(), PathList, BaseFS,
-                   FixNotes, EnableCheckProfile, ProfilePrefix);
+  std::vector<ClangTidyError> Errors;
+  ClangTidyStats Stats;
+  if (Jobs > 1 && PathList.size() > 1) {
+    Errors = runClangTidyInParallel(OptionsParser->getCompilations(), PathList,
+                                    ProfilePrefix, Stats);
+  } else {
+    Errors = runClangTidy(Context, OptionsParser->getCompilations(), PathList,
+                          BaseFS, FixNotes, EnableCheckProfile, ProfilePrefix);
+    Stats = Context.getStats();
+  }
   bool FoundErrors = llvm::any_of(Errors, [](const ClangTidyError &E) {
     return E.DiagLevel == ClangTidyError::Error;
   });
@@ -707,7 +776,7 @@ int clangTidyMain(int argc, const char **argv) {
   }
 
   if (!Quiet) {
-    printStats(Context.getStats());
+    printStats(Stats);
     if (DisableFixes && Behaviour != FB_NoFix)
       llvm::errs()
           << "Found compiler errors, but -fix-errors was not specified.\n"
@@ -48,6 +48,12 @@ public:
   /// Attempts to run Clang and store the parsed AST.
   /// If \p Preamble is non-null it is reused during parsing.
   /// This function does not check if preamble is valid to reuse.
+  ///
+  /// The main file is always parsed in full. Clang's AST cannot be edited in
+  /// place: declarations, source locations and the results of semantic
+  /// analysis of later code all point into earlier code, so there is no body
+  /// that can safely be re-parsed on its own. The preamble is what keeps
+  /// rebuilds cheap.
   static std::optional<ParsedAST>
   build(llvm::StringRef Filename, const ParseInputs &Inputs,
         std::unique_ptr<clang::CompilerInvocation> CI,
@@ -144,6 +144,11 @@ struct PreambleBuildStats {
 /// If \p PreambleCallback is set, it will be run on top of the AST while
 /// building the preamble.
 /// If Stats is not non-null, build statistics will be exported there.
+///
+/// Each preamble belongs to a single main file, even if another file starts
+/// with the same includes. The PCH records the main file's name and the
+/// bounds of its preamble, and header guards, __FILE__ and relative
+/// includes are all resolved against that file.
 std::shared_ptr<const PreambleData>
 buildPreamble(PathRef FileName, CompilerInvocation CI,
               const ParseInputs &Inputs, bool StoreInMemory,
@@ -138,6 +138,20 @@ BackgroundQueue::Task BackgroundIndex::changedFilesTask(
     // Run indexing for files that need to be updated.
     std::shuffle(NeedsReIndexing.begin(), NeedsReIndexing.end(),
                  std::mt19937(std::random_device{}()));
+    // Files the user edited recently are the most likely to be wanted soon,
+    // so index them first. Files with the same time, as after a checkout,
+    // stay shuffled.
+    {
+      auto FS = TFS.view(/*CWD=*/std::nullopt);
+      llvm::StringMap<llvm::sys::TimePoint<>> ModTimes;
+      for (const auto &File : NeedsReIndexing)
+        if (auto Stat = FS->status(File))
+          ModTimes[File] = Stat->getLastModificationTime();
+      llvm::stable_sort(NeedsReIndexing,
+                        [&](const std::string &L, const std::string &R) {
+                          return ModTimes.lookup(L) > ModTimes.lookup(R);
+                        });
+    }
     std::vector<BackgroundQueue::Task> Tasks;
     Tasks.reserve(NeedsReIndexing.size());
     for (const auto &File : NeedsReIndexing)
@@ -31,6 +31,7 @@
 #include <queue>
 #include <string>
 #include <thread>
+#include <tuple>
 #include <vector>
 
 namespace clang {
@@ -78,8 +79,11 @@ public:
     std::string Tag;       // Allows priority to be boosted later.
     uint64_t Key = 0;      // If the key matches a previous task, drop this one.
                            // (in practice this means we never reindex a file).
+    uint64_t Sequence = 0; // Set when enqueued. Equal priorities run in order.
 
-    bool operator<(const Task &O) const { return QueuePri < O.QueuePri; }
+    bool operator<(const Task &O) const {
+      return std::tie(QueuePri, O.Sequence) < std::tie(O.QueuePri, Sequence);
+    }
   };
 
   // Describes the number of tasks processed by the queue.
@@ -126,6 +130,7 @@ private:
   llvm::StringMap<unsigned> Boosts;
   std::function<void(Stats)> OnProgress;
   llvm::DenseSet<uint64_t> SeenKeys;
+  uint64_t NextSequence = 0;
 };
 
 // Builds an in-memory index by by running the static indexer action over
@@ -83,6 +83,7 @@ bool BackgroundQueue::adjust(Task &T) {
   if (T.Key && !SeenKeys.insert(T.Key).second)
     return false;
   T.QueuePri = std::max(T.QueuePri, Boosts.lookup(T.Tag));
+  T.Sequence = NextSequence++;
   return true;
 }
 
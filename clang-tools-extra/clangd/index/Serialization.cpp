@@ -242,14 +242,17 @@ llvm::Expected<StringTableIn> readStringTable(llvm::StringRef Data) {
   } else
     return error("Compressed string table, but zlib is unavailable");
 
+  // The table is already a sequence of null-terminated strings, so copy it
+  // into the arena in one piece and point into that copy, rather than saving
+  // each string separately.
   StringTableIn Table;
-  llvm::StringSaver Saver(Table.Arena);
-  R = Reader(Uncompressed);
-  for (Reader R(Uncompressed); !R.eof();) {
+  char *Copy = Table.Arena.Allocate<char>(Uncompressed.size());
+  std::copy(Uncompressed.begin(), Uncompressed.end(), Copy);
+  for (Reader R(llvm::StringRef(Copy, Uncompressed.size())); !R.eof();) {
     auto Len = R.rest().find(0);
     if (Len == llvm::StringRef::npos)
       return error("Bad string table: not null terminated");
-    Table.Strings.push_back(Saver.save(R.consume(Len)));
+    Table.Strings.push_back(R.consume(Len));
     R.consume8();
   }
   if (R.err())
@@ -98,16 +98,29 @@ private:
   }
 
   /// Advances CurrentChunk to the chunk which might contain ID.
+  ///
+  /// Intersections mostly advance to a nearby chunk, so gallop forward from
+  /// the current chunk to bound the search instead of binary searching all
+  /// of the remaining chunks.
   void advanceToChunk(DocID ID) {
-    if ((CurrentChunk != Chunks.end() - 1) &&
-        ((CurrentChunk + 1)->Head <= ID)) {
-      CurrentChunk =
-          std::partition_point(CurrentChunk + 1, Chunks.end(),
-                               [&](const Chunk &C) { return C.Head < ID; });
-      --CurrentChunk;
-      DecompressedChunk = CurrentChunk->decompress();
-      CurrentID = DecompressedChunk.begin();
+    auto Low = CurrentChunk + 1;
+    if (Low == Chunks.end() || Low->Head > ID)
+      return;
+    // Invariant: Low->Head <= ID.
+    size_t Step = 1;
+    while (static_cast<size_t>(Chunks.end() - Low) > Step &&
+           (Low + Step)->Head <= ID) {
+      Low += Step;
+      Step *= 2;
     }
+    auto High = static_cast<size_t>(Chunks.end() - Low) > Step ? Low + Step
+                                                               : Chunks.end();
+    CurrentChunk =
+        std::partition_point(Low + 1, High,
+                             [&](const Chunk &C) { return C.Head <= ID; });
+    --CurrentChunk;
+    DecompressedChunk = CurrentChunk->decompress();
+    CurrentID = DecompressedChunk.begin();
   }
 
   const Token *Tok;
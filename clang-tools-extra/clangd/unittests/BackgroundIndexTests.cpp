@@ -824,6 +824,19 @@ TEST(BackgroundQueueTest, Boost) {
   }
 }
 
+TEST(BackgroundQueueTest, EqualPriorityInOrder) {
+  std::string Sequence;
+  BackgroundQueue::Task A([&] { Sequence.push_back('A'); });
+  BackgroundQueue::Task B([&] { Sequence.push_back('B'); });
+  BackgroundQueue::Task C([&] { Sequence.push_back('C'); });
+
+  BackgroundQueue Q;
+  Q.append({A, B, C});
+  Q.push(A);
+  Q.work([&] { Q.stop(); });
+  EXPECT_EQ("ABCA", Sequence);
+}
+
 TEST(BackgroundQueueTest, Duplicates) {
   std::string Sequence;
   BackgroundQueue::Task A([&] { Sequence.push_back('A'); });
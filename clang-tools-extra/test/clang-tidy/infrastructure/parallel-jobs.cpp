@@ -0,0 +1,35 @@
+// Checking the files on two threads reports the same diagnostics and the same
+// counts as checking them one after another.
+
+// RUN: rm -rf %t && split-file %s %t
+// RUN: clang-tidy -checks='-*,google-explicit-constructor' -header-filter=shared -j 1 \
+// RUN:   %t/a.cpp %t/b.cpp -- -I%t > %t/j1.out 2> %t/j1.err
+// RUN: clang-tidy -checks='-*,google-explicit-constructor' -header-filter=shared -j 2 \
+// RUN:   %t/a.cpp %t/b.cpp -- -I%t > %t/j2.out 2> %t/j2.err
+// RUN: diff %t/j1.out %t/j2.out
+// RUN: FileCheck %s --input-file=%t/j2.out
+// RUN: FileCheck %s --check-prefix=STATS --input-file=%t/j1.err
+// RUN: FileCheck %s --check-prefix=STATS --input-file=%t/j2.err
+
+// CHECK-DAG: a.cpp:3:{{[0-9]+}}: warning: single-argument constructors must be marked explicit
+// CHECK-DAG: b.cpp:3:{{[0-9]+}}: warning: single-argument constructors must be marked explicit
+// CHECK-DAG: shared.h:1:{{[0-9]+}}: warning: single-argument constructors must be marked explicit
+// CHECK-NOT: warning:
+
+// STATS: Suppressed 2 warnings (2 in non-user code).
+
+//--- shared.h
+struct Shared { Shared(int); };
+
+//--- other.h
+struct Other { Other(int); };
+
+//--- a.cpp
+#include "shared.h"
+#include "other.h"
+struct A { A(int); };
+
+//--- b.cpp
+#include "shared.h"
+#include "other.h"
+struct B { B(int); };
@@ -111,6 +111,32 @@ TEST(ClangTidyDiagnosticConsumer, InvalidSourceLocationRangesIgnored) {
   EXPECT_EQ(1ul, Errors[3].Message.Ranges.size());
 }
 
+TEST(ClangTidyDiagnosticConsumer, MergesErrors) {
+  auto MakeError = [](StringRef Check, StringRef File, unsigned Offset,
+                      StringRef Message) {
+    ClangTidyError Error(Check, ClangTidyError::Warning, "", false);
+    Error.Message = tooling::DiagnosticMessage(Message);
+    Error.Message.FilePath = std::string(File);
+    Error.Message.FileOffset = Offset;
+    return Error;
+  };
+  std::vector<std::vector<ClangTidyError>> ErrorSets(2);
+  ErrorSets[0].push_back(MakeError("check-a", "a.cpp", 5, "in a"));
+  ErrorSets[0].push_back(MakeError("check-a", "h.h", 3, "in header"));
+  ErrorSets[1].push_back(MakeError("check-a", "b.cpp", 1, "in b"));
+  ErrorSets[1].push_back(MakeError("check-a", "h.h", 3, "in header"));
+  ErrorSets[1].push_back(MakeError("check-b", "h.h", 3, "in header"));
+
+  std::vector<ClangTidyError> Errors =
+      mergeClangTidyErrors(std::move(ErrorSets));
+  ASSERT_EQ(4ul, Errors.size());
+  EXPECT_EQ("in a", Errors[0].Message.Message);
+  EXPECT_EQ("in b", Errors[1].Message.Message);
+  EXPECT_EQ("check-a", Errors[2].DiagnosticName);
+  EXPECT_EQ("h.h", Errors[2].Message.FilePath);
+  EXPECT_EQ("check-b", Errors[3].DiagnosticName);
+}
+
 } // namespace test
 } // namespace tidy
 } // namespace clang
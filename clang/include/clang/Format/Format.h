@@ -5247,6 +5247,11 @@ struct FormattingAttemptStatus {
 /// Returns the ``Replacements`` necessary to make all \p Ranges comply with
 /// \p Style.
 ///
+/// The whole of \p Code is lexed and parsed into unwrapped lines even when
+/// \p Ranges is small: whether a line is inside a preprocessor branch,
+/// brace block or macro, and how neighbouring lines are aligned, depends on
+/// the code before it, so no parse state is kept between calls.
+///
 /// If ``Status`` is non-null, its value will be populated with the status of
 /// this formatting attempt. See \c FormattingAttemptStatus.
 tooling::Replacements reformat(const FormatStyle &Style, StringRef Code,
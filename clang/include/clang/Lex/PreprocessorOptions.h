@@ -193,7 +193,10 @@ public:
   /// effect on the dependencies for a compilation unit.
   ///
   /// Enables a client to cache the directives for a file and provide them
-  /// across multiple compiler invocations.
+  /// across multiple compiler invocations. This is the only token-level cache
+  /// shared between invocations: full compiles relex every header, because
+  /// the meaning of most header tokens depends on the macros defined when the
+  /// header is entered, so a raw token stream can't be replayed as is.
   /// FIXME: Allow returning an error.
   std::function<std::optional<ArrayRef<dependency_directives_scan::Directive>>(
       FileEntryRef)>
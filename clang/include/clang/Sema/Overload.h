@@ -977,6 +977,13 @@ class Sema;
 
   /// OverloadCandidateSet - A set of overload candidates, used in C++
   /// overload resolution (C++ 13.3).
+  ///
+  /// A set is built afresh for every call. The outcome is not a function of
+  /// the lookup result and the argument types alone: access checking,
+  /// default arguments, deduction and constraint checks on templates, and
+  /// the conversions considered all depend on the context of the call, and
+  /// checking a candidate can instantiate templates, which must happen at
+  /// that call's point of instantiation.
   class OverloadCandidateSet {
   public:
     enum CandidateSetKind {
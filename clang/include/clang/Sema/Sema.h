@@ -10468,6 +10468,15 @@ public:
   bool SubstBaseSpecifiers(CXXRecordDecl *Instantiation, CXXRecordDecl *Pattern,
                            const MultiLevelTemplateArgumentList &TemplateArgs);
 
+  /// Instantiate the definition of a class from its pattern.
+  ///
+  /// The result depends on what is visible at the point of instantiation,
+  /// not just on the pattern and its arguments: argument-dependent lookup and
+  /// declarations found in the second phase of lookup can differ between
+  /// translation units that include the same headers. Instantiations are
+  /// therefore shared across translation units only through a PCH or module
+  /// that performed them, which records the context they were made in; see
+  /// -fpch-instantiate-templates for a PCH.
   bool InstantiateClass(SourceLocation PointOfInstantiation,
                         CXXRecordDecl *Instantiation, CXXRecordDecl *Pattern,
                         const MultiLevelTemplateArgumentList &TemplateArgs,
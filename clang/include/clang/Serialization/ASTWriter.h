@@ -642,6 +642,10 @@ public:
   ///
   /// \return the module signature, which eventually will be a hash of
   /// the module but currently is merely a random 32-bit number.
+  ///
+  /// Writing is single threaded. Serializing a declaration or type assigns
+  /// IDs to everything it references and queues those for writing, so the
+  /// blocks are not independent until the whole graph has been numbered.
   ASTFileSignature WriteAST(Sema &SemaRef, StringRef OutputFile,
                             Module *WritingModule, StringRef isysroot,
                             bool ShouldCacheASTInMemory = false);
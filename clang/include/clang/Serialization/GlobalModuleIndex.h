@@ -177,6 +177,11 @@ public:
   static llvm::Error writeIndex(FileManager &FileMgr,
                                 const PCHContainerReader &PCHContainerRdr,
                                 llvm::StringRef Path);
+
+  /// Determine whether the index in \p Path already describes exactly the
+  /// module files that are in that directory now, so writing it again would
+  /// produce the same index.
+  static bool isUpToDate(llvm::StringRef Path);
 };
 }
 
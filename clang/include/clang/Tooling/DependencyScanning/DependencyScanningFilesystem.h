@@ -150,6 +150,13 @@ using CachedRealPath = llvm::ErrorOr<std::string>;
 ///
 /// It is sharded based on the hash of the key to reduce the lock contention for
 /// the worker threads.
+///
+/// The cache lives as long as the DependencyScanningService and is not
+/// persisted. Directive tokens refer to offsets in the file contents, so a
+/// persisted copy would still require reading and hashing every file to
+/// validate it, and would save only the directive scan, which is a single
+/// linear pass over that same buffer. Clients that scan repeatedly should
+/// keep one service alive across scans instead.
 class DependencyScanningFilesystemSharedCache {
 public:
   struct CacheShard {
@@ -1047,18 +1047,25 @@ private:
     const bool EnableCheckProfiling = Options.CheckProfiling.has_value();
     TimeBucketRegion Timer;
     auto &Matchers = this->Matchers->DeclOrStmt;
+    auto &ParentMap = getASTContext().getParentMapContext();
+    // Whether the node is skipped depends only on the traversal kind, and
+    // most matchers share one, so work it out once per kind.
+    std::optional<bool> IsIgnored[TK_IgnoreUnlessSpelledInSource + 1];
     for (unsigned short I : Filter) {
       auto &MP = Matchers[I];
       if (EnableCheckProfiling)
         Timer.setBucket(&TimeByBucket[MP.second->getID()]);
       BoundNodesTreeBuilder Builder;
 
-      {
-        TraversalKindScope RAII(getASTContext(), MP.first.getTraversalKind());
-        if (getASTContext().getParentMapContext().traverseIgnored(DynNode) !=
-            DynNode)
-          continue;
+      TraversalKind TK =
+          MP.first.getTraversalKind().value_or(ParentMap.getTraversalKind());
+      std::optional<bool> &Ignored = IsIgnored[TK];
+      if (!Ignored) {
+        TraversalKindScope RAII(getASTContext(), TK);
+        Ignored = ParentMap.traverseIgnored(DynNode) != DynNode;
       }
+      if (*Ignored)
+        continue;
 
       CurMatchRAII RAII(*this, MP.second, DynNode);
       if (MP.first.matches(DynNode, this, &Builder)) {
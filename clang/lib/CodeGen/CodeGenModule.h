@@ -1663,6 +1663,11 @@ private:
   void EmitCtorList(CtorList &Fns, const char *GlobalName);
 
   /// Emit any needed decls for which code generation was deferred.
+  ///
+  /// Every TU that uses an inline function emits its own linkonce_odr copy,
+  /// because a TU cannot know which other TUs will be in the link. To emit
+  /// such definitions once, put them in a PCH or module built with
+  /// -fpch-codegen or -fmodules-codegen, whose object file owns them.
   void EmitDeferred();
 
   /// Try to emit external vtables as available_externally if they have emitted
@@ -1224,12 +1224,21 @@ private:
 
     // While not empty, take first element and follow edges.
     while (!Queue.empty()) {
-      // Quit if we still haven't found a solution by now.
-      if (Count > 25'000'000)
-        return 0;
-
       Penalty = Queue.top().first.first;
       StateNode *Node = Queue.top().second;
+
+      // If we still haven't found a solution by now, finish the cheapest
+      // partial one without searching any further.
+      if (Count > 25'000'000) {
+        LLVM_DEBUG(llvm::dbgs() << "Search limit reached, completing the "
+                                   "line greedily.\n");
+        StateNode *Best = completeGreedily(Node, Penalty, &Count);
+        if (!Best)
+          return 0;
+        if (!DryRun)
+          reconstructPath(InitialState, Best);
+        return Penalty;
+      }
       if (!Node->State.NextToken) {
         LLVM_DEBUG(llvm::dbgs()
                    << "\n---\nPenalty for line: " << Penalty << "\n");
@@ -1294,6 +1303,29 @@ private:
     ++(*Count);
   }
 
+  /// Extends the partial solution ending in \p Node one token at a time,
+  /// always taking the cheaper of the allowed decisions.
+  ///
+  /// \p Penalty is the penalty of \p Node, and is updated to that of the
+  /// returned node. Returns \c nullptr if no decision is allowed for some
+  /// token.
+  StateNode *completeGreedily(StateNode *Node, unsigned &Penalty,
+                              unsigned *Count) {
+    while (Node->State.NextToken) {
+      QueueType Next;
+      FormatDecision LastFormat = Node->State.NextToken->getDecision();
+      if (LastFormat == FD_Unformatted || LastFormat == FD_Continue)
+        addNextStateToQueue(Penalty, Node, /*NewLine=*/false, Count, &Next);
+      if (LastFormat == FD_Unformatted || LastFormat == FD_Break)
+        addNextStateToQueue(Penalty, Node, /*NewLine=*/true, Count, &Next);
+      if (Next.empty())
+        return nullptr;
+      Penalty = Next.top().first.first;
+      Node = Next.top().second;
+    }
+    return Node;
+  }
+
   /// Applies the best formatting by reconstructing the path in the
   /// solution space that leads to \c Best.
   void reconstructPath(LineState &State, StateNode *Best) {
@@ -49,6 +49,10 @@
 
 #ifdef __SSE4_2__
 #include <nmmintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
 #endif
 
 using namespace clang;
@@ -1924,6 +1928,66 @@ fastParseASCIIIdentifier(const char *CurPtr,
       continue;
     return CurPtr;
   }
+#elif defined(__SSE2__)
+  // SSE2 is part of the x86-64 baseline, so this covers builds that can't
+  // assume SSE4.2. The compares are signed, which is fine: bytes with the
+  // high bit set are negative and fall outside every range.
+  constexpr ssize_t BytesPerRegister = 16;
+  const __m128i Case = _mm_set1_epi8(0x20);
+  const __m128i BeforeLower = _mm_set1_epi8('a' - 1);
+  const __m128i AfterLower = _mm_set1_epi8('z' + 1);
+  const __m128i BeforeDigit = _mm_set1_epi8('0' - 1);
+  const __m128i AfterDigit = _mm_set1_epi8('9' + 1);
+  const __m128i Underscore = _mm_set1_epi8('_');
+
+  while (LLVM_LIKELY(BufferEnd - CurPtr >= BytesPerRegister)) {
+    __m128i Cv = _mm_loadu_si128((const __m128i *)(CurPtr));
+    // Setting bit 5 maps 'A'-'Z' onto 'a'-'z', and nothing else onto them.
+    __m128i Lower = _mm_or_si128(Cv, Case);
+    __m128i IsLetter = _mm_and_si128(_mm_cmpgt_epi8(Lower, BeforeLower),
+                                     _mm_cmplt_epi8(Lower, AfterLower));
+    __m128i IsDigit = _mm_and_si128(_mm_cmpgt_epi8(Cv, BeforeDigit),
+                                    _mm_cmplt_epi8(Cv, AfterDigit));
+    __m128i IsIdentifier = _mm_or_si128(
+        _mm_or_si128(IsLetter, IsDigit), _mm_cmpeq_epi8(Cv, Underscore));
+
+    unsigned NotIdentifier = ~_mm_movemask_epi8(IsIdentifier) & 0xFFFF;
+    if (NotIdentifier == 0) {
+      CurPtr += BytesPerRegister;
+      continue;
+    }
+    return CurPtr + llvm::countr_zero(NotIdentifier);
+  }
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+  constexpr ssize_t BytesPerRegister = 16;
+  const uint8x16_t Case = vdupq_n_u8(0x20);
+  const uint8x16_t LowerA = vdupq_n_u8('a');
+  const uint8x16_t LetterRange = vdupq_n_u8('z' - 'a');
+  const uint8x16_t Digit0 = vdupq_n_u8('0');
+  const uint8x16_t DigitRange = vdupq_n_u8('9' - '0');
+  const uint8x16_t Underscore = vdupq_n_u8('_');
+
+  while (LLVM_LIKELY(BufferEnd - CurPtr >= BytesPerRegister)) {
+    uint8x16_t Cv = vld1q_u8((const uint8_t *)CurPtr);
+    // Unsigned range checks: C - Lo <= Hi - Lo. Setting bit 5 maps 'A'-'Z'
+    // onto 'a'-'z', and nothing else onto them.
+    uint8x16_t IsLetter =
+        vcleq_u8(vsubq_u8(vorrq_u8(Cv, Case), LowerA), LetterRange);
+    uint8x16_t IsDigit = vcleq_u8(vsubq_u8(Cv, Digit0), DigitRange);
+    uint8x16_t IsIdentifier =
+        vorrq_u8(vorrq_u8(IsLetter, IsDigit), vceqq_u8(Cv, Underscore));
+
+    // Narrow each byte of the mask to 4 bits so it fits in a scalar.
+    uint64_t Mask = vget_lane_u64(
+        vreinterpret_u64_u8(
+            vshrn_n_u16(vreinterpretq_u16_u8(IsIdentifier), 4)),
+        0);
+    if (Mask == ~UINT64_C(0)) {
+      CurPtr += BytesPerRegister;
+      continue;
+    }
+    return CurPtr + llvm::countr_zero(~Mask) / 4;
+  }
 #endif
 
   unsigned char C = *CurPtr;
@@ -2819,6 +2883,8 @@ static bool isEndOfBlockCommentWithEscapedNewLine(const char *CurPtr, Lexer *L,
 
 #ifdef __SSE2__
 #include <emmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
 #elif __ALTIVEC__
 #include <altivec.h>
 #undef bool
@@ -2907,6 +2973,16 @@ bool Lexer::SkipBlockComment(Token &Result, const char *CurPtr,
         }
         CurPtr += 16;
       }
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+      uint8x16_t Slashes = vdupq_n_u8('/');
+      while (CurPtr + 16 < BufferEnd) {
+        uint8x16_t Bytes = vld1q_u8((const uint8_t *)CurPtr);
+        if (LLVM_UNLIKELY(vmaxvq_u8(Bytes) >= 0x80))
+          goto MultiByteUTF8;
+        if (vmaxvq_u8(vceqq_u8(Bytes, Slashes)) != 0)
+          break;
+        CurPtr += 16;
+      }
 #elif __ALTIVEC__
       __vector unsigned char LongUTF = {0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
                                         0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
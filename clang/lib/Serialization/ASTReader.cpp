@@ -8080,16 +8080,16 @@ void ASTReader::StartTranslationUnit(ASTConsumer *Consumer) {
 void ASTReader::PrintStats() {
   std::fprintf(stderr, "*** AST File Statistics:\n");
 
-  unsigned NumTypesLoaded =
-      TypesLoaded.size() - llvm::count(TypesLoaded.materialized(), QualType());
-  unsigned NumDeclsLoaded =
-      DeclsLoaded.size() -
-      llvm::count(DeclsLoaded.materialized(), (Decl *)nullptr);
+  // Only materialized pages can hold loaded entities.
+  unsigned NumTypesLoaded = llvm::count_if(
+      TypesLoaded.materialized(), [](QualType T) { return !T.isNull(); });
+  unsigned NumDeclsLoaded = llvm::count_if(
+      DeclsLoaded.materialized(), [](const Decl *D) { return D; });
   unsigned NumIdentifiersLoaded =
-      IdentifiersLoaded.size() -
-      llvm::count(IdentifiersLoaded, (IdentifierInfo *)nullptr);
-  unsigned NumMacrosLoaded =
-      MacrosLoaded.size() - llvm::count(MacrosLoaded, (MacroInfo *)nullptr);
+      llvm::count_if(IdentifiersLoaded.materialized(),
+                     [](const IdentifierInfo *II) { return II; });
+  unsigned NumMacrosLoaded = llvm::count_if(
+      MacrosLoaded.materialized(), [](const MacroInfo *MI) { return MI; });
   unsigned NumSelectorsLoaded =
       SelectorsLoaded.size() - llvm::count(SelectorsLoaded, Selector());
 
@@ -21,6 +21,7 @@
 #include "llvm/ADT/MapVector.h"
 #include "llvm/ADT/SmallString.h"
 #include "llvm/ADT/StringRef.h"
+#include "llvm/ADT/StringSet.h"
 #include "llvm/Bitstream/BitstreamReader.h"
 #include "llvm/Bitstream/BitstreamWriter.h"
 #include "llvm/Support/DJB.h"
@@ -848,6 +849,50 @@ bool GlobalModuleIndexBuilder::writeIndex(llvm::BitstreamWriter &Stream) {
   return false;
 }
 
+bool GlobalModuleIndex::isUpToDate(StringRef Path) {
+  auto Result = readIndex(Path);
+  if (llvm::Error Err = std::move(Result.second)) {
+    llvm::consumeError(std::move(Err));
+    return false;
+  }
+  std::unique_ptr<GlobalModuleIndex> Index(Result.first);
+
+  auto Matches = [](StringRef FileName, off_t Size, time_t ModTime) {
+    llvm::sys::fs::file_status Status;
+    if (llvm::sys::fs::status(FileName, Status))
+      return false;
+    return off_t(Status.getSize()) == Size &&
+           llvm::sys::toTimeT(Status.getLastModificationTime()) == ModTime;
+  };
+
+  // Every module file the index knows about must be unchanged.
+  llvm::StringSet<> Known;
+  for (const ModuleInfo &Info : Index->Modules) {
+    if (Info.FileName.empty())
+      continue;
+    if (!Matches(Info.FileName, Info.Size, Info.ModTime))
+      return false;
+    Known.insert(Info.FileName);
+  }
+
+  // ... and every module file in the directory must be in the index.
+  std::error_code EC;
+  for (llvm::sys::fs::directory_iterator D(Path, EC), DEnd; D != DEnd && !EC;
+       D.increment(EC)) {
+    // A module file that another process is still writing has a lock file
+    // next to it, named after the module file. A lock left behind by a
+    // process that died doesn't mean anything is about to change.
+    StringRef Entry = D->path();
+    if (Entry.consume_back(".lock") && Entry.ends_with(".pcm") &&
+        llvm::LockFileManager::isLocked(Entry))
+      return false;
+    if (llvm::sys::path::extension(D->path()) == ".pcm" &&
+        !Known.count(D->path()))
+      return false;
+  }
+  return !EC;
+}
+
 llvm::Error
 GlobalModuleIndex::writeIndex(FileManager &FileMgr,
                               const PCHContainerReader &PCHContainerRdr,
@@ -856,6 +901,12 @@ GlobalModuleIndex::writeIndex(FileManager &FileMgr,
   IndexPath += Path;
   llvm::sys::path::append(IndexPath, IndexFileName);
 
+  // Building the index loads every module file in the directory. When many
+  // translation units finish building modules at once, most of them find an
+  // index that another process has just written, so check for that first.
+  if (isUpToDate(Path))
+    return llvm::Error::success();
+
   // Coordinate building the global index file with other processes that might
   // try to do the same.
   llvm::LockFileManager Locked(IndexPath);
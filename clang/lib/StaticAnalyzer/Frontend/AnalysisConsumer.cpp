@@ -451,6 +451,11 @@ void AnalysisConsumer::HandleDeclsCallGraph(const unsigned LocalTUDeclsSize) {
   // inlined functions. The topological order allows the "do not reanalyze
   // previously inlined function" performance heuristic to be triggered more
   // often.
+  //
+  // The walk is sequential by design. Which functions are skipped depends on
+  // what the earlier ones inlined, and the engine is not thread safe: it
+  // builds CFGs lazily, creates types through the ASTContext and may trigger
+  // deserialization from a PCH or CTU import while exploring a function.
   SetOfConstDecls Visited;
   SetOfConstDecls VisitedAsTopLevel;
   llvm::ReversePostOrderTraversal<clang::CallGraph*> RPOT(&CG);
@@ -25,7 +25,10 @@
 #include "llvm/Support/FileSystem.h"
 #include "llvm/Support/InitLLVM.h"
 #include "llvm/Support/Process.h"
+#include "llvm/Support/ThreadPool.h"
+#include <atomic>
 #include <fstream>
+#include <mutex>
 
 using namespace llvm;
 using clang::tooling::Replacements;
@@ -205,6 +208,12 @@ static cl::list<std::string> FileNames(cl::Positional,
                                        cl::desc("[@<file>] [<file> ...]"),
                                        cl::cat(ClangFormatCategory));
 
+static cl::opt<unsigned>
+    NumJobs("j",
+            cl::desc("Number of files to format in parallel when used with\n"
+                     "-i. Other modes always format one file at a time."),
+            cl::init(1), cl::cat(ClangFormatCategory));
+
 static cl::opt<bool> FailOnIncompleteFormat(
     "fail-on-incomplete-format",
     cl::desc("If set, fail with exit code 1 on incomplete format."),
@@ -714,15 +723,40 @@ int main(int argc, const char **argv) {
   }
 
   unsigned FileNo = 1;
-  bool Error = false;
-  for (const auto &FileName : FileNames) {
-    if (isIgnored(FileName))
-      continue;
+  std::mutex VerboseMutex;
+  auto FormatFile = [&](StringRef FileName) {
     if (Verbose) {
+      std::lock_guard<std::mutex> Lock(VerboseMutex);
       errs() << "Formatting [" << FileNo++ << "/" << FileNames.size() << "] "
              << FileName << "\n";
     }
-    Error |= clang::format::format(FileName, FailOnIncompleteFormat);
+    return clang::format::format(FileName, FailOnIncompleteFormat);
+  };
+
+  // Formatting in place writes nothing to stdout, so files can be processed
+  // concurrently without interleaving their output. isIgnored caches the last
+  // .clang-format-ignore file it read, so it runs before the files are handed
+  // to the pool.
+  if (Inplace && NumJobs > 1 && FileNames.size() > 1) {
+    std::atomic<bool> Error = false;
+    llvm::DefaultThreadPool Pool(llvm::hardware_concurrency(NumJobs));
+    for (const auto &FileName : FileNames) {
+      if (isIgnored(FileName))
+        continue;
+      Pool.async([&, FileName = StringRef(FileName)] {
+        if (FormatFile(FileName))
+          Error = true;
+      });
+    }
+    Pool.wait();
+    return Error ? 1 : 0;
+  }
+
+  bool Error = false;
+  for (const auto &FileName : FileNames) {
+    if (isIgnored(FileName))
+      continue;
+    Error |= FormatFile(FileName);
   }
   return Error ? 1 : 0;
 }
@@ -161,6 +161,11 @@ static int PrintSupportedExtensions(std::string TargetStr) {
   return 0;
 }
 
+// Each call builds a fresh CompilerInstance, so no FileManager, HeaderSearch
+// or module cache state is carried over between compilations, even when the
+// driver runs several -cc1 jobs in-process. Keeping that state warm across
+// requests would require invalidating it when the file system changes, which
+// the frontend's caches do not currently support.
 int cc1_main(ArrayRef<const char *> Argv, const char *Argv0, void *MainAddr) {
   ensureSufficientStack();
 
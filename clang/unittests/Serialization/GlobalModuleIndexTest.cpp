@@ -0,0 +1,78 @@
+//===- GlobalModuleIndexTest.cpp - GlobalModuleIndex tests ----------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#include "clang/Serialization/GlobalModuleIndex.h"
+#include "clang/Basic/FileManager.h"
+#include "clang/Basic/FileSystemOptions.h"
+#include "clang/Serialization/PCHContainerOperations.h"
+#include "llvm/ADT/SmallString.h"
+#include "llvm/Support/FileSystem.h"
+#include "llvm/Support/LockFileManager.h"
+#include "llvm/Support/MemoryBuffer.h"
+#include "llvm/Support/Path.h"
+#include "llvm/Support/raw_ostream.h"
+
+#include "gtest/gtest.h"
+
+using namespace llvm;
+using namespace clang;
+
+namespace {
+
+class GlobalModuleIndexTest : public ::testing::Test {
+  void SetUp() override {
+    ASSERT_FALSE(sys::fs::createUniqueDirectory("modules-index-test", TestDir));
+  }
+
+  void TearDown() override { sys::fs::remove_directories(TestDir); }
+
+public:
+  SmallString<256> TestDir;
+
+  void writeIndex() {
+    FileManager FileMgr{FileSystemOptions()};
+    RawPCHContainerReader PCHContainerRdr;
+    ASSERT_FALSE(errorToBool(
+        GlobalModuleIndex::writeIndex(FileMgr, PCHContainerRdr, TestDir)));
+  }
+};
+
+TEST_F(GlobalModuleIndexTest, UpToDateWithModuleLocks) {
+  writeIndex();
+  EXPECT_TRUE(GlobalModuleIndex::isUpToDate(TestDir));
+
+  SmallString<256> ModuleFile(TestDir);
+  sys::path::append(ModuleFile, "Foo.pcm");
+  SmallString<256> ModuleLock(ModuleFile);
+  ModuleLock += ".lock";
+
+  std::string Hostname;
+  {
+    // While another process is writing Foo.pcm, the index is about to go out
+    // of date.
+    LockFileManager Locked(ModuleFile);
+    ASSERT_EQ(LockFileManager::LFS_Owned, Locked.getState());
+    EXPECT_FALSE(GlobalModuleIndex::isUpToDate(TestDir));
+
+    auto Buffer = MemoryBuffer::getFile(ModuleLock);
+    ASSERT_TRUE(bool(Buffer));
+    Hostname = (*Buffer)->getBuffer().split(' ').first.str();
+  }
+
+  // A lock left behind on this host by a process that no longer exists
+  // doesn't make the index stale.
+  {
+    std::error_code EC;
+    raw_fd_ostream Out(ModuleLock, EC);
+    ASSERT_FALSE(EC);
+    Out << Hostname << " 2147483646";
+  }
+  EXPECT_TRUE(GlobalModuleIndex::isUpToDate(TestDir));
+}
+
+} // namespace
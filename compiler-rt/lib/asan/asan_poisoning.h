@@ -67,7 +67,14 @@ ALWAYS_INLINE void FastPoisonShadow(uptr aligned_beg, uptr aligned_size,
       if (page_end != shadow_end) {
         REAL(memset)((void *)page_end, 0, shadow_end - page_end);
       }
+#  if SANITIZER_LINUX
+      // The shadow is a private anonymous mapping, so MADV_DONTNEED both
+      // releases the pages and makes them read back as zero. Unlike
+      // remapping the range, this keeps the mapping and its madvise flags.
+      ReleaseMemoryPagesToOS(page_beg, page_end);
+#  else
       ReserveShadowMemoryRange(page_beg, page_end - 1, nullptr);
+#  endif
     }
   }
 #endif // SANITIZER_FUCHSIA
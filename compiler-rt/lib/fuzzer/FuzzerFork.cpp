@@ -6,6 +6,14 @@
 //
 //===----------------------------------------------------------------------===//
 // Spawn and orchestrate separate fuzzing processes.
+//
+// The workers are processes rather than threads because the coverage
+// counters, the value profile and the TracePC state are process-wide
+// globals written by the instrumentation without synchronization, and a
+// crash or timeout in the target has to be contained. The cost is that each
+// job is a short-lived process whose new features are merged back through
+// the file system. To amortize that, the time limit given to each job grows
+// with its JobId (see CreateNewJob), up to 300 seconds.
 //===----------------------------------------------------------------------===//
 
 #include "FuzzerCommand.h"
@@ -339,6 +339,11 @@ struct Allocator {
   }
 
   // -------------------- Allocation/Deallocation routines ---------------
+  // Most of the profiling overhead is not here but in the compiler inserted
+  // shadow counter updates on every memory access, which run whether or not
+  // the allocation is recorded. Recording only a sample of allocations would
+  // therefore save little; the caller has also already unwound the stack by
+  // the time we get here.
   void *Allocate(uptr size, uptr alignment, BufferedStackTrace *stack,
                  AllocType alloc_type) {
     if (UNLIKELY(!memprof_inited))
@@ -167,6 +167,13 @@ void __llvm_profile_instrument_target_value(uint64_t TargetValue, void *Data,
  * or if it hasn't been called, the \c LLVM_PROFILE_FILE environment variable,
  * or if that's not set, the last name set to INSTR_PROF_PROFILE_NAME_VAR,
  * or if that's not set,  \c "default.profraw".
+ *
+ * This may be called more than once, e.g. periodically from a long-running
+ * process. Each call writes the counters as they are at that moment; nothing
+ * is snapshotted, so counters keep changing while they are written. To write
+ * deltas, call \c __llvm_profile_reset_counters() after each write and merge
+ * the resulting files with llvm-profdata, or use the \c %m merge pattern so
+ * each write is merged into the existing file under a file lock.
  */
 int __llvm_profile_write_file(void);
 
@@ -44,6 +44,12 @@ namespace scudo {
 //
 // The memory used by this allocator is never unmapped, but can be partially
 // released if the platform allows for it.
+//
+// Releases are done at page granularity, so where the platform backs Regions
+// with transparent huge pages, a release splits the huge pages it touches. The
+// GroupSizeLog of the Config bounds the ranges considered for release at once,
+// and a negative ReleaseToOsIntervalMs disables periodic release entirely,
+// which keeps such mappings intact at the cost of RSS.
 
 template <typename Config> class SizeClassAllocator64 {
 public:
@@ -24,6 +24,14 @@
 
 namespace scudo {
 
+// A registry of TSDsArraySize TSDs shared by all threads, of which at most
+// the number of CPUs are used by default. Unlike TSDRegistryExT, the cache
+// memory is bounded by the number of TSDs rather than the number of threads.
+// Threads are assigned a TSD round-robin; on contention, getTSDAndLockSlow
+// probes a few other TSDs in random order and moves the thread to the first
+// free one, so busy threads spread out over the available TSDs. The
+// MaxTSDsCount option can raise the number of TSDs in use when the default is
+// too contended.
 template <class Allocator, u32 TSDsArraySize, u32 DefaultTSDCount>
 struct TSDRegistrySharedT {
   using ThisT = TSDRegistrySharedT<Allocator, TSDsArraySize, DefaultTSDCount>;
@@ -433,6 +433,11 @@ ALWAYS_INLINE USED void MemoryAccess(ThreadState* thr, uptr pc, uptr addr,
   Shadow cur(fast_state, addr, size, typ);
 
   LOAD_CURRENT_SHADOW(cur, shadow_mem);
+  // Repeated accesses by the same thread in the same epoch stop here, which
+  // is the common case. Skipping a fraction of the remaining accesses (e.g.
+  // for a sampling mode) would only make races less likely to be seen; the
+  // instrumented call and this shadow load would still be paid on every
+  // access.
   if (LIKELY(ContainsSameAccess(shadow_mem, cur, shadow, access, typ)))
     return;
   if (UNLIKELY(fast_state.GetIgnoreBit()))
@@ -28,6 +28,12 @@ namespace __xray {
 /// get from or return buffers to the queue. This is one key component of the
 /// "flight data recorder" (FDR) mode to support ongoing XRay function call
 /// trace collection.
+///
+/// Buffers are only read back once the queue is finalized, when the FDR flush
+/// walks the used buffers with apply() and writes them out. When all the
+/// buffers are handed out, getBuffer fails instead of blocking and the FDR
+/// controller drops records until a buffer is released, so a full queue costs
+/// trace data rather than latency in the instrumented threads.
 class BufferQueue {
 public:
   /// ControlBlock represents the memory layout of how we interpret the backing
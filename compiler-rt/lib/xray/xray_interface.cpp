@@ -344,6 +344,11 @@ XRayPatchingStatus controlPatching(bool Enable) XRAY_NEVER_INSTRUMENT {
   return XRayPatchingStatus::SUCCESS;
 }
 
+// Patches or unpatches the sleds of a single function, making only the pages
+// that hold them writeable. This is what makes selective tracing affordable:
+// a handler can unpatch a function from within its own entry event, as the
+// coverage-sample test does, to drop hot functions after the first few calls
+// instead of paying for __xray_patch/__xray_unpatch over the whole binary.
 XRayPatchingStatus mprotectAndPatchFunction(int32_t FuncId,
                                             bool Enable) XRAY_NEVER_INSTRUMENT {
   XRaySledMap InstrMap;
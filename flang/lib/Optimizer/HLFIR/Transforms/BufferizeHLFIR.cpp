@@ -33,12 +33,15 @@
 #include "mlir/Support/LogicalResult.h"
 #include "mlir/Transforms/DialectConversion.h"
 #include "llvm/ADT/TypeSwitch.h"
+#include "llvm/Support/Debug.h"
 
 namespace hlfir {
 #define GEN_PASS_DEF_BUFFERIZEHLFIR
 #include "flang/Optimizer/HLFIR/Passes.h.inc"
 } // namespace hlfir
 
+#define DEBUG_TYPE "bufferize-hlfir"
+
 namespace {
 
 /// Helper to create tuple from a bufferized expr storage and clean up
@@ -776,6 +779,10 @@ struct ElementalOpConversion
     if (adaptor.getMold())
       mold = getBufferizedExprStorage(adaptor.getMold());
     auto extents = hlfir::getIndexExtents(loc, builder, shape);
+    // Elementals that inline-elementals and opt-bufferization could not
+    // remove end up here and get an array temporary.
+    LLVM_DEBUG(llvm::dbgs() << "Creating array temporary for elemental at "
+                            << loc << "\n");
     auto [temp, cleanup] =
         createArrayTemp(loc, builder, elemental.getType(), shape, extents,
                         adaptor.getTypeparams(), mold);
@@ -25,6 +25,7 @@
 #include "flang/Common/uint128.h"
 #include "flang/Runtime/cpp-type.h"
 #include "flang/Runtime/descriptor.h"
+#include <limits>
 
 namespace Fortran::runtime::io::descr {
 template <typename A>
@@ -38,6 +39,29 @@ inline RT_API_ATTRS A &ExtractElement(IoStatementState &io,
   return *p;
 }
 
+// On output, a repeated data edit descriptor like 1000F12.6 is interpreted
+// once and then applied to as many of the remaining elements as it covers.
+// Input still takes one edit per element so that list-directed repetition
+// and null values keep working.
+template <Direction DIR>
+inline RT_API_ATTRS int MaxDataEditRepeat(std::size_t remainingElements) {
+  if constexpr (DIR == Direction::Output) {
+    return static_cast<int>(std::min<std::size_t>(
+        remainingElements, std::numeric_limits<int>::max()));
+  } else {
+    return 1;
+  }
+}
+
+template <Direction DIR>
+inline RT_API_ATTRS int DataEditRepeat(const DataEdit &edit) {
+  if constexpr (DIR == Direction::Output) {
+    return edit.repeat > 1 ? edit.repeat : 1;
+  } else {
+    return 1;
+  }
+}
+
 // Per-category descriptor-based I/O templates
 
 // TODO (perhaps as a nontrivial but small starter project): implement
@@ -52,8 +76,13 @@ inline RT_API_ATTRS bool FormattedIntegerIO(
   descriptor.GetLowerBounds(subscripts);
   using IntType = CppTypeFor<TypeCategory::Integer, KIND>;
   bool anyInput{false};
-  for (std::size_t j{0}; j < numElements; ++j) {
-    if (auto edit{io.GetNextDataEdit()}) {
+  for (std::size_t j{0}; j < numElements;) {
+    auto edit{io.GetNextDataEdit(MaxDataEditRepeat<DIR>(numElements - j))};
+    if (!edit) {
+      return false;
+    }
+    for (int r{DataEditRepeat<DIR>(*edit)}; r > 0 && j < numElements;
+         --r, ++j) {
       IntType &x{ExtractElement<IntType>(io, descriptor, subscripts)};
       if constexpr (DIR == Direction::Output) {
         if (!EditIntegerOutput<KIND>(io, *edit, x)) {
@@ -70,8 +99,6 @@ inline RT_API_ATTRS bool FormattedIntegerIO(
         io.GetIoErrorHandler().Crash(
             "FormattedIntegerIO: subscripts out of bounds");
       }
-    } else {
-      return false;
     }
   }
   return true;
@@ -85,8 +112,13 @@ inline RT_API_ATTRS bool FormattedRealIO(
   descriptor.GetLowerBounds(subscripts);
   using RawType = typename RealOutputEditing<KIND>::BinaryFloatingPoint;
   bool anyInput{false};
-  for (std::size_t j{0}; j < numElements; ++j) {
-    if (auto edit{io.GetNextDataEdit()}) {
+  for (std::size_t j{0}; j < numElements;) {
+    auto edit{io.GetNextDataEdit(MaxDataEditRepeat<DIR>(numElements - j))};
+    if (!edit) {
+      return false;
+    }
+    for (int r{DataEditRepeat<DIR>(*edit)}; r > 0 && j < numElements;
+         --r, ++j) {
       RawType &x{ExtractElement<RawType>(io, descriptor, subscripts)};
       if constexpr (DIR == Direction::Output) {
         if (!RealOutputEditing<KIND>{io, x}.Edit(*edit)) {
@@ -103,8 +135,6 @@ inline RT_API_ATTRS bool FormattedRealIO(
         io.GetIoErrorHandler().Crash(
             "FormattedRealIO: subscripts out of bounds");
       }
-    } else {
-      return false;
     }
   }
   return true;
@@ -18,6 +18,11 @@
 // to cover all of the valid possibilities.
 //
 // Places where BLAS routines could be called are marked as TODO items.
+// The runtime deliberately has no BLAS or threading dependency of its own: it
+// must build for the same targets as the compiler (including offload devices,
+// see RT_API_ATTRS), and calls made from inside a user's OpenMP parallel
+// region must not spawn threads. Applications that need peak MATMUL
+// performance on large arrays should call a tuned BLAS library directly.
 
 #include "flang/Runtime/matmul.h"
 #include "terminator.h"
@@ -14,6 +14,7 @@
 #include <cstring>
 #include <gtest/gtest.h>
 #include <tuple>
+#include <vector>
 
 using namespace Fortran::runtime;
 using namespace Fortran::runtime::io;
@@ -267,6 +268,60 @@ TEST(IOApiTests, DescriptorOutputTest) {
       << std::string{buffer, sizeof buffer} << "'";
 }
 
+TEST(IOApiTests, RepeatedEditArrayOutput) {
+  // Each case writes the arrays in one statement, so a repeated edit
+  // descriptor may cover fewer elements than remain, more elements than
+  // remain, or continue from one array into the next.
+  using ArraysTy = std::vector<std::vector<std::int32_t>>;
+  using ParamsTy = std::tuple<const char *, ArraysTy, const char *>;
+  static const std::vector<ParamsTy> params{
+      {"(5I3)", ArraysTy{{1, 2, 3}}, "  1  2  3"},
+      {"(1I3,1I4,1I5)", ArraysTy{{1, 2, 3}}, "  1   2    3"},
+      {"(2I3,'|',2I3)", ArraysTy{{1, 2, 3}}, "  1  2|  3"},
+      {"(4I3)", ArraysTy{{1, 2}, {3, 4}}, "  1  2  3  4"},
+      {"(3I3,I5)", ArraysTy{{1, 2}, {3, 4}}, "  1  2  3    4"},
+  };
+
+  for (const auto &[format, arrays, expect] : params) {
+    char buffer[32];
+    auto cookie{IONAME(BeginInternalFormattedOutput)(
+        buffer, sizeof buffer, format, std::strlen(format))};
+    for (const auto &array : arrays) {
+      StaticDescriptor<1> staticDescriptor;
+      Descriptor &desc{staticDescriptor.descriptor()};
+      const SubscriptValue extent[]{
+          static_cast<SubscriptValue>(array.size())};
+      desc.Establish(TypeCategory::Integer, sizeof(std::int32_t),
+          const_cast<std::int32_t *>(array.data()), 1, extent);
+      EXPECT_TRUE(IONAME(OutputDescriptor)(cookie, desc));
+    }
+    auto status{IONAME(EndIoStatement)(cookie)};
+    ASSERT_EQ(status, 0) << "'" << format << "' failed, status "
+                         << static_cast<int>(status);
+    std::string got{buffer, sizeof buffer};
+    EXPECT_TRUE(CompareFormattedStrings(expect, std::string{got}))
+        << "'" << format << "': expected '" << expect << "', got '" << got
+        << "'";
+  }
+
+  // Real arrays take the same path.
+  double reals[]{1.5, 2.5};
+  StaticDescriptor<1> staticDescriptor;
+  Descriptor &desc{staticDescriptor.descriptor()};
+  static const SubscriptValue extent[]{2};
+  desc.Establish(TypeCategory::Real, sizeof(double), reals, 1, extent);
+  const char *format{"(3F5.1)"};
+  char buffer[16];
+  auto cookie{IONAME(BeginInternalFormattedOutput)(
+      buffer, sizeof buffer, format, std::strlen(format))};
+  EXPECT_TRUE(IONAME(OutputDescriptor)(cookie, desc));
+  ASSERT_EQ(IONAME(EndIoStatement)(cookie), 0);
+  EXPECT_TRUE(
+      CompareFormattedStrings("  1.5  2.5", std::string{buffer, sizeof buffer}))
+      << "'" << format << "': got '" << std::string{buffer, sizeof buffer}
+      << "'";
+}
+
 //------------------------------------------------------------------------------
 /// Tests for output formatting real values
 //------------------------------------------------------------------------------
@@ -38,6 +38,11 @@ static_assert(sizeof(Buffer) == 64, "Buffer size mismatch");
 
 /// The information associated with a packet. This indicates which operations to
 /// perform and which threads are active in the slots.
+///
+/// A packet holds one Buffer for each lane of the calling warp or wavefront.
+/// All active lanes of a group that make the same call share a single round
+/// trip to the server. Different groups use different ports, so they can
+/// proceed in parallel, up to MAX_PORT_COUNT.
 struct Header {
   uint64_t mask;
   uint16_t opcode;
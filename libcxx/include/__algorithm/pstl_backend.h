@@ -182,6 +182,16 @@ implemented, all the algorithms will eventually forward to the basis algorithms
 
 // TODO: Complete this list
 
+CPU backends
+============
+
+`__cpu_backend_tag` implements the algorithms above in terms of a few parallel primitives, such as
+`__parallel_for`, `__parallel_merge`, `__parallel_transform_reduce` and `__parallel_stable_sort`, which are provided by
+the CPU backend selected with `LIBCXX_PSTL_CPU_BACKEND` at configuration time (serial, std_thread or libdispatch). A new
+CPU backend, for example one built on a persistent thread pool, only has to provide these primitives. Note that the
+std_thread backend is a reference implementation and spawns threads per call, so it is not expected to outperform the
+serial algorithms on small inputs.
+
 Exception handling
 ==================
 
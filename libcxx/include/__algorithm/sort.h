@@ -924,7 +924,13 @@ __sort_dispatch(_RandomAccessIterator __first, _RandomAccessIterator __last, _Co
 
   // Only use bitset partitioning for arithmetic types.  We should also check
   // that the default comparator is in use so that we are sure that there are no
-  // branches in the comparator.
+  // branches in the comparator. The same condition selects the branchless
+  // sorting networks used for small subranges.
+  //
+  // A radix sort is not used here even for integral keys: it needs a buffer
+  // the size of the input, and std::sort is not expected to allocate. A
+  // ranges::sort with a projection composes the projection into the
+  // comparator, so it takes the generic path.
   std::__introsort<_AlgPolicy,
                    _Comp&,
                    _RandomAccessIterator,
@@ -28,6 +28,7 @@
 #include <__format/formatter_char.h>
 #include <__format/formatter_floating_point.h>
 #include <__format/formatter_integer.h>
+#include <__format/formatter_output.h>
 #include <__format/formatter_pointer.h>
 #include <__format/formatter_string.h>
 #include <__format/parser_std_format_spec.h>
@@ -305,6 +306,18 @@ _LIBCPP_HIDE_FROM_ABI constexpr typename _Ctx::iterator __vformat_to(_ParseCtx&&
   auto __end                       = __parse_ctx.end();
   typename _Ctx::iterator __out_it = __ctx.out();
   while (__begin != __end) {
+    if constexpr (same_as<decltype(__out_it), back_insert_iterator<__output_buffer<_CharT>>>) {
+      // Copy a run of literal characters to the buffer in one go instead of
+      // one character at a time.
+      auto __first = __begin;
+      while (__begin != __end && *__begin != _CharT('{') && *__begin != _CharT('}'))
+        ++__begin;
+      if (__first != __begin) {
+        __out_it = __formatter::__copy(basic_string_view<_CharT>{__first, __begin}, std::move(__out_it));
+        continue;
+      }
+    }
+
     switch (*__begin) {
     case _CharT('{'):
       ++__begin;
@@ -408,6 +408,10 @@ void unsynchronized_pool_resource::do_deallocate(void* p, size_t bytes, size_t a
   }
 }
 
+// synchronized_pool_resource wraps an unsynchronized_pool_resource and a
+// single mutex, so its allocations and deallocations are serialized. Giving
+// it per-thread pools would change the layout of the class, which is part of
+// the ABI, so it is expected to be a correct rather than scalable default.
 bool synchronized_pool_resource::do_is_equal(const memory_resource& other) const noexcept { return &other == this; }
 
 // 23.12.6, mem.res.monotonic.buffer
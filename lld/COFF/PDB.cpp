@@ -55,6 +55,7 @@
 #include "llvm/Support/Errc.h"
 #include "llvm/Support/FormatAdapters.h"
 #include "llvm/Support/FormatVariadic.h"
+#include "llvm/Support/Parallel.h"
 #include "llvm/Support/Path.h"
 #include "llvm/Support/ScopedPrinter.h"
 #include "llvm/Support/TimeProfiler.h"
@@ -1206,8 +1207,8 @@ void PDBLinker::addPublicsToPDB() {
   ScopedTimer t3(ctx.publicsLayoutTimer);
   // Compute the public symbols.
   auto &gsiBuilder = builder.getGsiBuilder();
-  std::vector<pdb::BulkPublic> publics;
-  ctx.symtab.forEachSymbol([&publics, this](Symbol *s) {
+  std::vector<Defined *> publicDefs;
+  ctx.symtab.forEachSymbol([&publicDefs, this](Symbol *s) {
     // Only emit external, defined, live symbols that have a chunk. Static,
     // non-external symbols do not appear in the symbol table.
     auto *def = dyn_cast<Defined>(s);
@@ -1228,10 +1229,17 @@ void PDBLinker::addPublicsToPDB() {
           return;
         }
       }
-      publics.push_back(createPublic(ctx, def));
+      publicDefs.push_back(def);
     }
   });
 
+  // Computing the output section and offset of every public is independent
+  // per symbol, so do it in parallel.
+  std::vector<pdb::BulkPublic> publics(publicDefs.size());
+  parallelFor(0, publicDefs.size(), [&](size_t i) {
+    publics[i] = createPublic(ctx, publicDefs[i]);
+  });
+
   if (!publics.empty()) {
     publicSymbols = publics.size();
     gsiBuilder.addPublicSymbols(std::move(publics));
@@ -66,6 +66,7 @@
 #include "llvm/Support/TargetSelect.h"
 #include "llvm/Support/TimeProfiler.h"
 #include "llvm/Support/raw_ostream.h"
+#include "llvm/Support/xxhash.h"
 #include <cstdlib>
 #include <tuple>
 #include <utility>
@@ -574,6 +575,157 @@ constexpr const char *saveTempsValues[] = {
     "resolution", "preopt",     "promote", "internalize",  "import",
     "opt",        "precodegen", "prelink", "combinedindex"};
 
+// --skip-unchanged-link=<dir> records the state of each successful link in
+// <dir>: a hash of the lld version and the command line, the size and
+// modification time of the output, a hash of every file the link read, and
+// the modification time of every directory lld searched or read a file from.
+// The latter catches a file added to a search path, which would change which
+// library -l picks. If the next link has the same command line, the output
+// has not been touched and none of the recorded files and directories has
+// changed, the output is already up to date and the link is skipped.
+// Otherwise we do a full link. The previous output is never patched in place.
+//
+// LTO reads files, such as sample profiles, outside of lld's control, so no
+// state is recorded for links with bitcode inputs. Diagnostics of the
+// previous link are not repeated, and auxiliary outputs such as the -Map file
+// are not rewritten.
+static std::string getLinkStatePath() {
+  SmallString<128> output(config->outputFile);
+  fs::make_absolute(output);
+  return (config->skipUnchangedLinkDir + "/" +
+          utohexstr(xxh3_64bits(StringRef(output))) + ".state")
+      .str();
+}
+
+static uint64_t getCommandLineHash(opt::InputArgList &args) {
+  std::string cmdline = getLLDVersion();
+  for (const opt::Arg *arg : args) {
+    cmdline += '\0';
+    cmdline += arg->getAsString(args);
+  }
+  return xxh3_64bits(cmdline);
+}
+
+// Returns a string identifying the contents of the file at `path`, or an
+// empty string if it cannot be read.
+static std::string getFileHash(StringRef path) {
+  auto mbOrErr = MemoryBuffer::getFile(path, /*IsText=*/false,
+                                       /*RequiresNullTerminator=*/false);
+  if (!mbOrErr)
+    return "";
+  return utohexstr(xxh3_64bits((*mbOrErr)->getBuffer()));
+}
+
+// Returns a string identifying the size and modification time of the file or
+// directory at `path`, or an empty string if it does not exist.
+static std::string getFileStatus(StringRef path) {
+  fs::file_status st;
+  if (fs::status(path, st))
+    return "";
+  return utostr(st.getSize()) + ":" +
+         utostr(st.getLastModificationTime().time_since_epoch().count());
+}
+
+static bool isOutputUpToDate(opt::InputArgList &args) {
+  auto mbOrErr = MemoryBuffer::getFile(getLinkStatePath(), /*IsText=*/true);
+  if (!mbOrErr)
+    return false;
+
+  // The state consists of "<tag> <value> <path>" lines. 'c' is the command
+  // line hash, 'o' the status of the output file, 'd' the status of a
+  // directory and 'f' the hash of an input file.
+  SmallVector<std::pair<StringRef, StringRef>, 0> files;
+  bool sawCommandLine = false, sawOutput = false;
+  SmallVector<StringRef, 0> lines;
+  (*mbOrErr)->getBuffer().split(lines, '\n', -1, /*KeepEmpty=*/false);
+  for (StringRef line : lines) {
+    auto [tag, rest] = line.split(' ');
+    auto [value, path] = rest.split(' ');
+    if (tag == "c") {
+      if (value != utohexstr(getCommandLineHash(args)))
+        return false;
+      sawCommandLine = true;
+    } else if (tag == "o") {
+      if (path != config->outputFile || value != getFileStatus(path))
+        return false;
+      sawOutput = true;
+    } else if (tag == "d") {
+      if (value != getFileStatus(path))
+        return false;
+    } else if (tag == "f") {
+      files.emplace_back(value, path);
+    } else {
+      return false;
+    }
+  }
+  if (!sawCommandLine || !sawOutput)
+    return false;
+
+  // Hashing the inputs is the bulk of the work; do it in parallel.
+  SmallVector<std::string, 0> hashes(files.size());
+  parallelFor(0, files.size(),
+              [&](size_t i) { hashes[i] = getFileHash(files[i].second); });
+  for (size_t i = 0, e = files.size(); i != e; ++i)
+    if (hashes[i] != files[i].first)
+      return false;
+  return true;
+}
+
+static void writeLinkState(opt::InputArgList &args) {
+  std::string statePath = getLinkStatePath();
+  std::string outputStatus = getFileStatus(config->outputFile);
+  if (!ctx.bitcodeFiles.empty() || !ctx.lazyBitcodeFiles.empty() ||
+      outputStatus.empty()) {
+    fs::remove(statePath);
+    return;
+  }
+
+  // Create the state file before taking the status of any directory, as that
+  // may change the status of the directory it is created in.
+  StringRef stateDir = config->skipUnchangedLinkDir;
+  if (std::error_code ec = fs::create_directories(stateDir)) {
+    warn("--skip-unchanged-link: cannot create " + stateDir + ": " +
+         ec.message());
+    return;
+  }
+  std::error_code ec;
+  raw_fd_ostream os(statePath, ec, fs::OF_Text);
+  if (ec) {
+    warn("--skip-unchanged-link: cannot write " + statePath + ": " +
+         ec.message());
+    return;
+  }
+
+  // Every file the link read, including thin archive members, is owned by
+  // ctx.memoryBuffers. Hash the contents the link actually used.
+  SmallVector<StringRef, 0> paths;
+  for (MemoryBuffer &mb : llvm::make_pointee_range(ctx.memoryBuffers))
+    paths.push_back(mb.getBufferIdentifier());
+  SmallVector<std::string, 0> hashes(paths.size());
+  parallelFor(0, paths.size(), [&](size_t i) {
+    hashes[i] = utohexstr(xxh3_64bits(ctx.memoryBuffers[i]->getBuffer()));
+  });
+
+  SetVector<CachedHashString> dirs;
+  dirs.insert(CachedHashString("."));
+  for (StringRef dir : config->searchPaths) {
+    if (dir.starts_with("="))
+      dir = saver().save(config->sysroot + dir.substr(1));
+    dirs.insert(CachedHashString(dir));
+  }
+  for (StringRef path : paths) {
+    StringRef dir = path::parent_path(path);
+    dirs.insert(CachedHashString(dir.empty() ? "." : dir));
+  }
+
+  os << "c " << utohexstr(getCommandLineHash(args)) << '\n';
+  os << "o " << outputStatus << ' ' << config->outputFile << '\n';
+  for (StringRef dir : dirs)
+    os << "d " << getFileStatus(dir) << ' ' << dir << '\n';
+  for (size_t i = 0, e = paths.size(); i != e; ++i)
+    os << "f " << hashes[i] << ' ' << paths[i] << '\n';
+}
+
 void LinkerDriver::linkerMain(ArrayRef<const char *> argsArr) {
   ELFOptTable parser;
   opt::InputArgList args = parser.parse(argsArr.slice(1));
@@ -653,7 +805,17 @@ void LinkerDriver::linkerMain(ArrayRef<const char *> argsArr) {
     if (errorCount())
       return;
 
-    invokeELFT(link, args);
+    if (!config->skipUnchangedLinkDir.empty() && isOutputUpToDate(args)) {
+      log("--skip-unchanged-link: " + config->outputFile + " is up to date");
+    } else {
+      invokeELFT(link, args);
+      if (!config->skipUnchangedLinkDir.empty()) {
+        if (errorCount())
+          fs::remove(getLinkStatePath());
+        else
+          writeLinkState(args);
+      }
+    }
   }
 
   if (config->timeTraceEnabled) {
@@ -1375,6 +1537,8 @@ static void readConfigs(opt::InputArgList &args) {
   config->sectionStartMap = getSectionStartMap(args);
   config->shared = args.hasArg(OPT_shared);
   config->singleRoRx = !args.hasFlag(OPT_rosegment, OPT_no_rosegment, true);
+  config->skipUnchangedLinkDir =
+      args.getLastArgValue(OPT_skip_unchanged_link);
   config->soName = args.getLastArgValue(OPT_soname);
   config->sortSection = getSortSection(args);
   config->splitStackAdjustSize = args::getInteger(args, OPT_split_stack_adjust_size, 16384);
@@ -1386,6 +1550,9 @@ static void readConfigs(opt::InputArgList &args) {
   config->thinLTOCachePolicy = CHECK(
       parseCachePruningPolicy(args.getLastArgValue(OPT_thinlto_cache_policy)),
       "--thinlto-cache-policy: invalid cache policy");
+  config->thinLTODistributor = args.getLastArgValue(OPT_thinlto_distributor_eq);
+  config->thinLTODistributorArgs =
+      args::getStrings(args, OPT_thinlto_distributor_arg_eq);
   config->thinLTOEmitImportsFiles = args.hasArg(OPT_thinlto_emit_imports_files);
   config->thinLTOEmitIndexFiles = args.hasArg(OPT_thinlto_emit_index_files) ||
                                   args.hasArg(OPT_thinlto_index_only) ||
@@ -1411,6 +1578,8 @@ static void readConfigs(opt::InputArgList &args) {
     error("--thinlto-prefix-replace=old_dir;new_dir;obj_dir must be used with "
           "--thinlto-index-only=");
   }
+  if (!config->thinLTODistributor.empty() && config->thinLTOIndexOnly)
+    error("--thinlto-distributor= is not supported with --thinlto-index-only");
   config->thinLTOModulesToCompile =
       args::getStrings(args, OPT_thinlto_single_module_eq);
   config->timeTraceEnabled = args.hasArg(OPT_time_trace_eq);
@@ -1609,11 +1778,16 @@ static void readConfigs(opt::InputArgList &args) {
   // non-LTO parts.
   if (auto *arg = args.getLastArg(OPT_threads)) {
     StringRef v(arg->getValue());
-    unsigned threads = 0;
-    if (!llvm::to_integer(v, threads, 0) || threads == 0)
-      error(arg->getSpelling() + ": expected a positive integer, but got '" +
-            arg->getValue() + "'");
-    parallel::strategy = hardware_concurrency(threads);
+    if (v == "jobserver") {
+      parallel::strategy = hardware_concurrency();
+      parallel::strategy.UseJobserver = true;
+    } else {
+      unsigned threads = 0;
+      if (!llvm::to_integer(v, threads, 0) || threads == 0)
+        error(arg->getSpelling() + ": expected a positive integer, but got '" +
+              arg->getValue() + "'");
+      parallel::strategy = hardware_concurrency(threads);
+    }
     config->thinLTOJobs = v;
   } else if (parallel::strategy.compute_thread_count() > 16) {
     log("set maximum concurrency to 16, specify --threads= to change");
@@ -1621,6 +1795,13 @@ static void readConfigs(opt::InputArgList &args) {
   }
   if (auto *arg = args.getLastArg(OPT_thinlto_jobs_eq))
     config->thinLTOJobs = arg->getValue();
+  int64_t memoryBudget =
+      args::getInteger(args, OPT_thinlto_memory_budget_eq, 0);
+  if (memoryBudget < 0)
+    error("--thinlto-memory-budget: expected a non-negative integer, but got " +
+          Twine(memoryBudget));
+  config->thinLTOMemoryBudget = uint64_t(std::max<int64_t>(memoryBudget, 0))
+                                << 20;
   config->threadCount = parallel::strategy.compute_thread_count();
 
   if (config->ltoPartitions == 0)
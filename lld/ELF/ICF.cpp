@@ -514,8 +514,17 @@ template <class ELFT> void ICF<ELFT>::run() {
 
   // From now on, sections in Sections vector are ordered so that sections
   // in the same equivalence class are consecutive in the vector.
-  llvm::stable_sort(sections, [](const InputSection *a, const InputSection *b) {
-    return a->eqClass[0] < b->eqClass[0];
+  //
+  // This vector can have millions of elements, so sort it in parallel. The
+  // order within a class must not depend on the sorting algorithm, so break
+  // ties by the original position, which is temporarily stored to eqClass[1].
+  // eqClass[1] is not used again before segregate() overwrites it.
+  parallelFor(0, sections.size(),
+              [&](size_t i) { sections[i]->eqClass[1] = i; });
+  llvm::parallelSort(sections, [](const InputSection *a,
+                                  const InputSection *b) {
+    return std::make_pair(a->eqClass[0], a->eqClass[1]) <
+           std::make_pair(b->eqClass[0], b->eqClass[1]);
   });
 
   // Compare static contents and assign unique equivalence class IDs for each
@@ -26,6 +26,7 @@
 #include "llvm/Support/ARMBuildAttributes.h"
 #include "llvm/Support/Endian.h"
 #include "llvm/Support/FileSystem.h"
+#include "llvm/Support/Parallel.h"
 #include "llvm/Support/Path.h"
 #include "llvm/Support/RISCVAttributeParser.h"
 #include "llvm/Support/TarWriter.h"
@@ -246,6 +247,12 @@ std::optional<MemoryBufferRef> elf::readFile(StringRef path) {
   }
 
   MemoryBufferRef mbref = (*mbOrErr)->getMemBufferRef();
+  // Object files and shared objects are read in full, so have the kernel start
+  // reading them in now rather than faulting pages in one at a time, which is
+  // slow on network file systems. Archives are left alone, as usually only a
+  // few of their members are extracted.
+  if (identify_magic(mbref.getBuffer()) != file_magic::archive)
+    (*mbOrErr)->adviseIfMmap(sys::fs::access_hint::will_need);
   ctx.memoryBuffers.push_back(std::move(*mbOrErr)); // take MB ownership
 
   if (tar)
@@ -333,6 +340,14 @@ extern template void ObjFile<ELF64BE>::importCmseSymbols();
 template <class ELFT>
 static void doParseFiles(const std::vector<InputFile *> &files,
                          InputFile *armCmseImpLib) {
+  // Hashing symbol names is a significant part of symbol table insertion, and
+  // unlike the insertion itself it does not depend on the order in which files
+  // are processed. Compute the hashes in parallel.
+  parallelForEach(files, [](InputFile *file) {
+    if (file->kind() == InputFile::ObjKind && file->ekind == config->ekind)
+      cast<ObjFile<ELFT>>(file)->hashGlobalSymbolNames();
+  });
+
   // Add all files to the symbol table. This will add almost all symbols that we
   // need to the symbol table. This process might add files to the link due to
   // addDependentLibrary.
@@ -1113,7 +1128,9 @@ void ObjFile<ELFT>::initializeSymbols(const object::ELFFile<ELFT> &obj) {
   // Some entries have been filled by LazyObjFile.
   for (size_t i = firstGlobal, end = eSyms.size(); i != end; ++i)
     if (!symbols[i])
-      symbols[i] = symtab.insert(CHECK(eSyms[i].getName(stringTable), this));
+      symbols[i] =
+          insertGlobalSymbol(i, CHECK(eSyms[i].getName(stringTable), this));
+  globalSymbolNameHashes = {};
 
   // Perform symbol resolution on non-local symbols.
   SmallVector<unsigned, 32> undefineds;
@@ -1860,6 +1877,30 @@ ELFFileBase *elf::createObjFile(MemoryBufferRef mb, StringRef archiveName,
   return f;
 }
 
+template <class ELFT> void ObjFile<ELFT>::hashGlobalSymbolNames() {
+  ArrayRef<Elf_Sym> eSyms = this->getELFSyms<ELFT>();
+  SmallVector<uint32_t, 0> hashes;
+  hashes.reserve(eSyms.size() - firstGlobal);
+  for (const Elf_Sym &eSym : eSyms.slice(firstGlobal)) {
+    // Leave invalid names to the serial symbol resolution, which reports
+    // them.
+    Expected<StringRef> name = eSym.getName(stringTable);
+    if (!name) {
+      consumeError(name.takeError());
+      return;
+    }
+    hashes.push_back(SymbolTable::hashName(*name));
+  }
+  globalSymbolNameHashes = std::move(hashes);
+}
+
+template <class ELFT>
+Symbol *ObjFile<ELFT>::insertGlobalSymbol(size_t i, StringRef name) {
+  if (globalSymbolNameHashes.empty())
+    return symtab.insert(name);
+  return symtab.insert(name, globalSymbolNameHashes[i - firstGlobal]);
+}
+
 template <class ELFT> void ObjFile<ELFT>::parseLazy() {
   const ArrayRef<typename ELFT::Sym> eSyms = this->getELFSyms<ELFT>();
   numSymbols = eSyms.size();
@@ -1871,7 +1912,8 @@ template <class ELFT> void ObjFile<ELFT>::parseLazy() {
   for (size_t i = firstGlobal, end = eSyms.size(); i != end; ++i) {
     if (eSyms[i].st_shndx == SHN_UNDEF)
       continue;
-    symbols[i] = symtab.insert(CHECK(eSyms[i].getName(stringTable), this));
+    symbols[i] =
+        insertGlobalSymbol(i, CHECK(eSyms[i].getName(stringTable), this));
     symbols[i]->resolve(LazySymbol{*this});
     if (!lazy)
       break;
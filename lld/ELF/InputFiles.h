@@ -293,11 +293,17 @@ public:
   void postParse();
   void importCmseSymbols();
 
+  // Compute the symbol table hashes of global symbol names in advance. This
+  // is thread-safe and is called in parallel before symbol resolution, which
+  // is serial.
+  void hashGlobalSymbolNames();
+
 private:
   void initializeSections(bool ignoreComdats,
                           const llvm::object::ELFFile<ELFT> &obj);
   void initializeSymbols(const llvm::object::ELFFile<ELFT> &obj);
   void initializeJustSymbols();
+  Symbol *insertGlobalSymbol(size_t i, StringRef name);
 
   InputSectionBase *getRelocTarget(uint32_t idx, const Elf_Shdr &sec,
                                    uint32_t info);
@@ -320,6 +326,10 @@ private:
   // If the section does not exist (which is common), the array is empty.
   ArrayRef<Elf_Word> shndxTable;
 
+  // Hashes of global symbol names computed by hashGlobalSymbolNames. Empty if
+  // they have not been computed.
+  SmallVector<uint32_t, 0> globalSymbolNameHashes;
+
   // Debugging information to retrieve source file and line for error
   // reporting. Linker may find reasonable number of errors in a
   // single object file, so we cache debugging information in order to
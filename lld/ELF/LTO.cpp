@@ -138,6 +138,7 @@ static lto::Config createConfig() {
 
   for (const llvm::StringRef &name : config->thinLTOModulesToCompile)
     c.ThinLTOModulesToCompile.emplace_back(name);
+  c.ThinLTOMemoryBudget = config->thinLTOMemoryBudget;
 
   c.TimeTraceEnabled = config->timeTraceEnabled;
   c.TimeTraceGranularity = config->timeTraceGranularity;
@@ -181,6 +182,14 @@ BitcodeCompiler::BitcodeCompiler() {
         std::string(config->thinLTOPrefixReplaceNew),
         std::string(config->thinLTOPrefixReplaceNativeObject),
         config->thinLTOEmitImportsFiles, indexFile.get(), onIndexWrite);
+  } else if (!config->thinLTODistributor.empty()) {
+    backend = lto::createOutOfProcessThinBackend(
+        llvm::heavyweight_hardware_concurrency(config->thinLTOJobs),
+        std::string(config->thinLTODistributor),
+        std::vector<std::string>(config->thinLTODistributorArgs.begin(),
+                                 config->thinLTODistributorArgs.end()),
+        onIndexWrite, config->thinLTOEmitIndexFiles,
+        config->thinLTOEmitImportsFiles);
   } else {
     backend = lto::createInProcessThinBackend(
         llvm::heavyweight_hardware_concurrency(config->thinLTOJobs),
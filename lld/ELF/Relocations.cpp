@@ -455,15 +455,28 @@ private:
   ArrayRef<EhSectionPiece>::iterator i, j;
 };
 
+// Target-specific state which relocation scanning of one input file would
+// otherwise write to global data structures. MIPS and PPC64 collect it here
+// while files are scanned in parallel, and scanRelocations merges the shards
+// in input file order afterwards.
+struct RelocationScanShard {
+  // MIPS: the GOT entries required by the file.
+  std::unique_ptr<MipsGotSection::FileGot> mipsGot;
+  // PPC64: TOC entries to add to ppc64noTocRelax.
+  SmallVector<std::pair<const Symbol *, uint64_t>, 0> ppc64NoTocRelax;
+};
+
 // This class encapsulates states needed to scan relocations for one
 // InputSectionBase.
 class RelocationScanner {
 public:
+  RelocationScanner(RelocationScanShard *shard = nullptr) : shard(shard) {}
   template <class ELFT> void scanSection(InputSectionBase &s);
 
 private:
   InputSectionBase *sec;
   OffsetGetter getter;
+  RelocationScanShard *shard;
 
   // End of relocations, used by Mips/PPC64.
   const void *end = nullptr;
@@ -473,8 +486,15 @@ private:
   int64_t computeMipsAddend(const RelTy &rel, RelExpr expr, bool isLocal) const;
   bool isStaticLinkTimeConstant(RelExpr e, RelType type, const Symbol &sym,
                                 uint64_t relOff) const;
+  MipsGotSection::FileGot &getMipsGot() const;
   void processAux(RelExpr expr, RelType type, uint64_t offset, Symbol &sym,
                   int64_t addend) const;
+  unsigned handleMipsTlsRelocation(RelType type, Symbol &sym,
+                                   InputSectionBase &c, uint64_t offset,
+                                   int64_t addend, RelExpr expr) const;
+  unsigned handleTlsRelocation(RelType type, Symbol &sym, InputSectionBase &c,
+                               uint64_t offset, int64_t addend,
+                               RelExpr expr) const;
   template <class ELFT, class RelTy> void scanOne(RelTy *&i);
   template <class ELFT, class RelTy> void scan(ArrayRef<RelTy> rels);
 };
@@ -1036,6 +1056,16 @@ bool RelocationScanner::isStaticLinkTimeConstant(RelExpr e, RelType type,
   return true;
 }
 
+MipsGotSection::FileGot &RelocationScanner::getMipsGot() const {
+  if (!shard)
+    return in.mipsGot->getGot(*sec->file);
+  if (!shard->mipsGot) {
+    shard->mipsGot = std::make_unique<MipsGotSection::FileGot>();
+    shard->mipsGot->file = sec->file;
+  }
+  return *shard->mipsGot;
+}
+
 // The reason we have to do this early scan is as follows
 // * To mmap the output file, we need to know the size
 // * For that, we need to know how many dynamic relocs we will have.
@@ -1095,7 +1125,7 @@ void RelocationScanner::processAux(RelExpr expr, RelType type, uint64_t offset,
       // See "Global Offset Table" in Chapter 5 in the following document
       // for detailed description:
       // ftp://www.linux-mips.org/pub/linux/mips/doc/ABI/mipsabi.pdf
-      in.mipsGot->addEntry(*sec->file, sym, addend, expr);
+      MipsGotSection::addEntry(getMipsGot(), sym, addend, expr);
     } else if (!sym.isTls() || config->emachine != EM_LOONGARCH) {
       // Many LoongArch TLS relocs reuse the R_LOONGARCH_GOT type, in which
       // case the NEEDS_GOT flag shouldn't get set.
@@ -1179,7 +1209,7 @@ void RelocationScanner::processAux(RelExpr expr, RelType type, uint64_t offset,
       // a dynamic relocation.
       // ftp://www.linux-mips.org/pub/linux/mips/doc/ABI/mipsabi.pdf p.4-19
       if (config->emachine == EM_MIPS)
-        in.mipsGot->addEntry(*sec->file, sym, addend, expr);
+        MipsGotSection::addEntry(getMipsGot(), sym, addend, expr);
       return;
     }
   }
@@ -1260,16 +1290,18 @@ void RelocationScanner::processAux(RelExpr expr, RelType type, uint64_t offset,
 // pollute other `handleTlsRelocation` by MIPS `ifs` statements.
 // Mips has a custom MipsGotSection that handles the writing of GOT entries
 // without dynamic relocations.
-static unsigned handleMipsTlsRelocation(RelType type, Symbol &sym,
-                                        InputSectionBase &c, uint64_t offset,
-                                        int64_t addend, RelExpr expr) {
+unsigned RelocationScanner::handleMipsTlsRelocation(RelType type, Symbol &sym,
+                                                   InputSectionBase &c,
+                                                   uint64_t offset,
+                                                   int64_t addend,
+                                                   RelExpr expr) const {
   if (expr == R_MIPS_TLSLD) {
-    in.mipsGot->addTlsIndex(*c.file);
+    MipsGotSection::addTlsIndex(getMipsGot());
     c.addReloc({expr, type, offset, addend, &sym});
     return 1;
   }
   if (expr == R_MIPS_TLSGD) {
-    in.mipsGot->addDynTlsEntry(*c.file, sym);
+    MipsGotSection::addDynTlsEntry(getMipsGot(), sym);
     c.addReloc({expr, type, offset, addend, &sym});
     return 1;
   }
@@ -1283,9 +1315,10 @@ static unsigned handleMipsTlsRelocation(RelType type, Symbol &sym,
 // symbol in TLS block.
 //
 // Returns the number of relocations processed.
-static unsigned handleTlsRelocation(RelType type, Symbol &sym,
-                                    InputSectionBase &c, uint64_t offset,
-                                    int64_t addend, RelExpr expr) {
+unsigned RelocationScanner::handleTlsRelocation(RelType type, Symbol &sym,
+                                               InputSectionBase &c,
+                                               uint64_t offset, int64_t addend,
+                                               RelExpr expr) const {
   if (expr == R_TPREL || expr == R_TPREL_NEG) {
     if (config->shared) {
       errorOrWarn("relocation " + toString(type) + " against " + toString(sym) +
@@ -1470,8 +1503,12 @@ template <class ELFT, class RelTy> void RelocationScanner::scanOne(RelTy *&i) {
     // Record the TOC entry (.toc + addend) as not relaxable. See the comment in
     // InputSectionBase::relocateAlloc().
     if (type == R_PPC64_TOC16_LO && sym.isSection() && isa<Defined>(sym) &&
-        cast<Defined>(sym).section->name == ".toc")
-      ppc64noTocRelax.insert({&sym, addend});
+        cast<Defined>(sym).section->name == ".toc") {
+      if (shard)
+        shard->ppc64NoTocRelax.emplace_back(&sym, addend);
+      else
+        ppc64noTocRelax.insert({&sym, addend});
+    }
 
     if ((type == R_PPC64_TLSGD && expr == R_TLSDESC_CALL) ||
         (type == R_PPC64_TLSLD && expr == R_TLSLD_HINT)) {
@@ -1602,25 +1639,14 @@ template <class ELFT> void elf::scanRelocations() {
   // directly processed by InputSection::relocateNonAlloc.
 
   // Deterministic parallellism needs sorting relocations which is unsuitable
-  // for -z nocombreloc. MIPS and PPC64 use global states which are not suitable
-  // for parallelism.
-  bool serial = !config->zCombreloc || config->emachine == EM_MIPS ||
-                config->emachine == EM_PPC64;
-  parallel::TaskGroup tg;
-  for (ELFFileBase *f : ctx.objectFiles) {
-    auto fn = [f]() {
-      RelocationScanner scanner;
-      for (InputSectionBase *s : f->getSections()) {
-        if (s && s->kind() == SectionBase::Regular && s->isLive() &&
-            (s->flags & SHF_ALLOC) &&
-            !(s->type == SHT_ARM_EXIDX && config->emachine == EM_ARM))
-          scanner.template scanSection<ELFT>(*s);
-      }
-    };
-    tg.spawn(fn, serial);
-  }
-
-  tg.spawn([] {
+  // for -z nocombreloc. MIPS and PPC64 have target-specific global states;
+  // each file records its part of them into a shard, and the shards are merged
+  // in input file order once all files have been scanned.
+  bool serial = !config->zCombreloc;
+  bool sharded = config->emachine == EM_MIPS || config->emachine == EM_PPC64;
+  SmallVector<RelocationScanShard, 0> shards(sharded ? ctx.objectFiles.size()
+                                                     : 0);
+  auto scanEhAndExidx = [] {
     RelocationScanner scanner;
     for (Partition &part : partitions) {
       for (EhInputSection *sec : part.ehFrame->sections)
@@ -1630,7 +1656,41 @@ template <class ELFT> void elf::scanRelocations() {
           if (sec->isLive())
             scanner.template scanSection<ELFT>(*sec);
     }
-  });
+  };
+
+  {
+    parallel::TaskGroup tg;
+    for (size_t i = 0, e = ctx.objectFiles.size(); i != e; ++i) {
+      ELFFileBase *f = ctx.objectFiles[i];
+      RelocationScanShard *shard = sharded ? &shards[i] : nullptr;
+      auto fn = [f, shard]() {
+        RelocationScanner scanner(shard);
+        for (InputSectionBase *s : f->getSections()) {
+          if (s && s->kind() == SectionBase::Regular && s->isLive() &&
+              (s->flags & SHF_ALLOC) &&
+              !(s->type == SHT_ARM_EXIDX && config->emachine == EM_ARM))
+            scanner.template scanSection<ELFT>(*s);
+        }
+      };
+      tg.spawn(fn, serial);
+    }
+
+    // .eh_frame relocations update the state of the file they belong to, which
+    // may be scanned concurrently. For sharded targets, scan them after the
+    // shards have been merged.
+    if (!sharded)
+      tg.spawn(scanEhAndExidx);
+  }
+
+  if (!sharded)
+    return;
+  for (RelocationScanShard &shard : shards) {
+    if (shard.mipsGot)
+      in.mipsGot->addFileGot(std::move(*shard.mipsGot));
+    ppc64noTocRelax.insert(shard.ppc64NoTocRelax.begin(),
+                           shard.ppc64NoTocRelax.end());
+  }
+  scanEhAndExidx();
 }
 
 static bool handleNonPreemptibleIfunc(Symbol &sym, uint16_t flags) {
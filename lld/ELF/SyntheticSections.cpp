@@ -728,9 +728,8 @@ MipsGotSection::MipsGotSection()
     : SyntheticSection(SHF_ALLOC | SHF_WRITE | SHF_MIPS_GPREL, SHT_PROGBITS, 16,
                        ".got") {}
 
-void MipsGotSection::addEntry(InputFile &file, Symbol &sym, int64_t addend,
+void MipsGotSection::addEntry(FileGot &g, Symbol &sym, int64_t addend,
                               RelExpr expr) {
-  FileGot &g = getGot(file);
   if (expr == R_MIPS_GOT_LOCAL_PAGE) {
     if (const OutputSection *os = sym.getOutputSection())
       g.pagesMap.insert({os, {}});
@@ -748,12 +747,18 @@ void MipsGotSection::addEntry(InputFile &file, Symbol &sym, int64_t addend,
     g.local16.insert({{&sym, addend}, 0});
 }
 
-void MipsGotSection::addDynTlsEntry(InputFile &file, Symbol &sym) {
-  getGot(file).dynTlsSymbols.insert({&sym, 0});
+void MipsGotSection::addDynTlsEntry(FileGot &g, Symbol &sym) {
+  g.dynTlsSymbols.insert({&sym, 0});
 }
 
-void MipsGotSection::addTlsIndex(InputFile &file) {
-  getGot(file).dynTlsSymbols.insert({nullptr, 0});
+void MipsGotSection::addTlsIndex(FileGot &g) {
+  g.dynTlsSymbols.insert({nullptr, 0});
+}
+
+void MipsGotSection::addFileGot(FileGot &&g) {
+  assert(g.file && g.file->mipsGotIndex == uint32_t(-1));
+  g.file->mipsGotIndex = gots.size();
+  gots.push_back(std::move(g));
 }
 
 size_t MipsGotSection::FileGot::getEntriesNum() const {
@@ -2794,10 +2799,12 @@ readPubNamesAndTypes(const LLDDwarfObj<ELFT> &obj,
 }
 
 // Create a list of symbols from a given list of symbol names and types
-// by uniquifying them by name.
+// by uniquifying them by name. nameAttrs is released as soon as it is no longer
+// needed to reduce the peak memory usage, which can be dominated by this
+// function for large executables.
 static std::pair<SmallVector<GdbIndexSection::GdbSymbol, 0>, size_t>
 createSymbols(
-    ArrayRef<SmallVector<GdbIndexSection::NameAttrEntry, 0>> nameAttrs,
+    SmallVector<SmallVector<GdbIndexSection::NameAttrEntry, 0>, 0> &&nameAttrs,
     const SmallVector<GdbIndexSection::GdbChunk, 0> &chunks) {
   using GdbSymbol = GdbIndexSection::GdbSymbol;
   using NameAttrEntry = GdbIndexSection::NameAttrEntry;
@@ -2840,18 +2847,24 @@ createSymbols(
     }
   });
 
+  // The name entries and the hash tables are no longer needed.
+  nameAttrs = {};
+  map.reset();
+
   size_t numSymbols = 0;
   for (ArrayRef<GdbSymbol> v : ArrayRef(symbols.get(), numShards))
     numSymbols += v.size();
 
   // The return type is a flattened vector, so we'll copy each vector
-  // contents to Ret.
+  // contents to Ret. Free each shard once it has been copied.
   SmallVector<GdbSymbol, 0> ret;
   ret.reserve(numSymbols);
   for (SmallVector<GdbSymbol, 0> &vec :
-       MutableArrayRef(symbols.get(), numShards))
+       MutableArrayRef(symbols.get(), numShards)) {
     for (GdbSymbol &sym : vec)
       ret.push_back(std::move(sym));
+    vec = {};
+  }
 
   // CU vectors and symbol names are adjacent in the output file.
   // We can compute their offsets in the output file now.
@@ -2869,7 +2882,7 @@ createSymbols(
     errorOrWarn("--gdb-index: constant pool size (" + Twine(off) +
                 ") exceeds UINT32_MAX");
 
-  return {ret, off};
+  return {std::move(ret), off};
 }
 
 // Returns a newly-created .gdb_index section.
@@ -2922,7 +2935,8 @@ std::unique_ptr<GdbIndexSection> GdbIndexSection::create() {
 
   auto ret = std::make_unique<GdbIndexSection>();
   ret->chunks = std::move(chunks);
-  std::tie(ret->symbols, ret->size) = createSymbols(nameAttrs, ret->chunks);
+  std::tie(ret->symbols, ret->size) =
+      createSymbols(std::move(nameAttrs), ret->chunks);
 
   // Count the areas other than the constant pool.
   ret->size += sizeof(GdbIndexHeader) + ret->computeSymtabSize() * 8;
@@ -189,9 +189,19 @@ public:
   // primary and optional multiple secondary GOTs.
   void build();
 
-  void addEntry(InputFile &file, Symbol &sym, int64_t addend, RelExpr expr);
-  void addDynTlsEntry(InputFile &file, Symbol &sym);
-  void addTlsIndex(InputFile &file);
+  struct FileGot;
+
+  // Return (and create if necessary) `FileGot`.
+  FileGot &getGot(InputFile &f);
+
+  // Add a GOT entry to a per-file GOT. The GOT does not have to be owned by
+  // this section yet: relocation scanning fills up a separate GOT for each
+  // input file in parallel and then hands them over by addFileGot in input
+  // file order, so that the result does not depend on thread scheduling.
+  static void addEntry(FileGot &g, Symbol &sym, int64_t addend, RelExpr expr);
+  static void addDynTlsEntry(FileGot &g, Symbol &sym);
+  static void addTlsIndex(FileGot &g);
+  void addFileGot(FileGot &&g);
 
   uint64_t getPageEntryOffset(const InputFile *f, const Symbol &s,
                               int64_t addend) const;
@@ -308,6 +318,7 @@ private:
   // Symbol and addend.
   using GotEntry = std::pair<Symbol *, int64_t>;
 
+public:
   struct FileGot {
     InputFile *file = nullptr;
     size_t startIndex = 0;
@@ -339,14 +350,12 @@ private:
     size_t getIndexedEntriesNum() const;
   };
 
+private:
   // Container of GOT created for each input file.
   // After building a final series of GOTs this container
   // holds primary and secondary GOT's.
   std::vector<FileGot> gots;
 
-  // Return (and create if necessary) `FileGot`.
-  FileGot &getGot(InputFile &f);
-
   // Try to merge two GOTs. In case of success the `Dst` contains
   // result of merging and the function returns true. In case of
   // overflow the `Dst` is unchanged and the function returns false.
@@ -334,7 +334,18 @@ template <class ELFT> void Writer<ELFT>::run() {
   // Handle --print-map(-M)/--Map and --cref. Dump them before checkSections()
   // because the files may be useful in case checkSections() or openFile()
   // fails, for example, due to an erroneous file size.
-  writeMapAndCref();
+  //
+  // The map file only depends on the final layout, so if it goes to a file,
+  // write it in the background while we are writing the output file. It is
+  // waited for before the output is committed, since a failed commit exits,
+  // and by the destructor of mapTg on the early returns. An error that exits
+  // lld while it is still running, such as one reaching --error-limit in
+  // writeSections(), does not wait, and may leave the map file incomplete.
+  parallel::TaskGroup mapTg;
+  if (!config->mapFile.empty() && config->mapFile != "-")
+    mapTg.spawn(writeMapAndCref);
+  else
+    writeMapAndCref();
 
   // Handle --print-memory-usage option.
   if (config->printMemoryUsage)
@@ -369,9 +380,13 @@ template <class ELFT> void Writer<ELFT>::run() {
     if (errorCount())
       return;
 
-    if (auto e = buffer->commit())
-      fatal("failed to write output '" + buffer->getPath() +
-            "': " + toString(std::move(e)));
+    mapTg.sync();
+    {
+      llvm::TimeTraceScope timeScope("Commit output file");
+      if (auto e = buffer->commit())
+        fatal("failed to write output '" + buffer->getPath() +
+              "': " + toString(std::move(e)));
+    }
 
     if (!config->cmseOutputLib.empty())
       writeARMCmseImportLib<ELFT>();
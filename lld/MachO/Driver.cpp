@@ -1234,6 +1234,21 @@ static void createFiles(const InputArgList &args) {
   }
 }
 
+// Splitting C string literal sections into pieces is relatively expensive
+// because every piece is hashed for deduplication. Nothing needs the pieces
+// before input sections are gathered, so split the sections of all input files
+// at once, in parallel.
+static void splitCStringSections() {
+  TimeTraceScope timeScope("Split C string sections");
+  parallelForEach(inputFiles, [](const InputFile *file) {
+    for (const Section *section : file->sections)
+      for (const Subsection &subsection : section->subsections)
+        if (auto *isec = dyn_cast<CStringInputSection>(subsection.isec))
+          if (isec->pieces.empty())
+            isec->splitIntoPieces();
+  });
+}
+
 static void gatherInputSections() {
   TimeTraceScope timeScope("Gathering input sections");
   for (const InputFile *file : inputFiles) {
@@ -1958,6 +1973,7 @@ bool link(ArrayRef<const char *> argsArr, llvm::raw_ostream &stdoutOS,
       inputFiles.insert(make<OpaqueFile>(MemoryBufferRef(), segName, sectName));
     }
 
+    splitCStringSections();
     gatherInputSections();
     if (config->callGraphProfileSort)
       priorityBuilder.extractCallGraphProfile();
@@ -455,11 +455,15 @@ void UnwindInfoSectionImpl::finalize() {
   relocateCompactUnwind(cuEntries);
 
   // Rather than sort & fold the 32-byte entries directly, we create a
-  // vector of indices to entries and sort & fold that instead.
+  // vector of indices to entries and sort & fold that instead. Ties are broken
+  // by index so that the output does not depend on how the sort is split
+  // across threads.
   cuIndices.resize(cuEntries.size());
   std::iota(cuIndices.begin(), cuIndices.end(), 0);
-  llvm::sort(cuIndices, [&](size_t a, size_t b) {
-    return cuEntries[a].functionAddress < cuEntries[b].functionAddress;
+  parallelSort(cuIndices, [&](size_t a, size_t b) {
+    if (cuEntries[a].functionAddress != cuEntries[b].functionAddress)
+      return cuEntries[a].functionAddress < cuEntries[b].functionAddress;
+    return a < b;
   });
 
   // Record the ending boundary before we fold the entries.
@@ -0,0 +1,63 @@
+; REQUIRES: x86
+;; --thinlto-distributor= runs each ThinLTO backend job with an external
+;; executor. A job whose executor fails is run in-process with a warning.
+
+; RUN: rm -rf %t && split-file %s %t && cd %t
+; RUN: opt -module-summary a.ll -o a.o
+; RUN: llvm-mc -filetype=obj -triple=x86_64 remote.s -o remote.o
+
+;; The object written by the executor is linked instead of a local backend run.
+; RUN: ld.lld --thinlto-distributor=%python --thinlto-distributor-arg=distributor.py \
+; RUN:   --thinlto-distributor-arg=remote.o -shared a.o -o remote.so 2>&1 | count 0
+; RUN: llvm-nm remote.so | FileCheck %s --check-prefix=REMOTE
+
+; REMOTE: T f
+; REMOTE: T remote_marker
+
+;; If the executor fails, the job runs locally and the link still succeeds.
+; RUN: ld.lld --thinlto-distributor=%python --thinlto-distributor-arg=distributor.py \
+; RUN:   --thinlto-distributor-arg=fail -shared a.o -o local.so 2>&1 | \
+; RUN:   FileCheck %s --check-prefix=WARN
+; RUN: llvm-nm local.so | FileCheck %s --check-prefix=LOCAL
+
+; WARN: warning: ThinLTO remote job for a.o failed, running it locally: executor exited with code 1
+; LOCAL-NOT: remote_marker
+; LOCAL: T f
+; LOCAL-NOT: remote_marker
+
+;; The warning goes through the linker's diagnostics.
+; RUN: not ld.lld --thinlto-distributor=%python --thinlto-distributor-arg=distributor.py \
+; RUN:   --thinlto-distributor-arg=fail --fatal-warnings -shared a.o -o /dev/null 2>&1 | \
+; RUN:   FileCheck %s --check-prefix=FATAL
+; RUN: ld.lld --thinlto-distributor=%python --thinlto-distributor-arg=distributor.py \
+; RUN:   --thinlto-distributor-arg=fail --no-warnings -shared a.o -o /dev/null 2>&1 | count 0
+
+; FATAL: error: ThinLTO remote job for a.o failed, running it locally
+
+;--- a.ll
+target datalayout = "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-f80:128-n8:16:32:64-S128"
+target triple = "x86_64-unknown-linux-gnu"
+
+define void @f() {
+entry:
+  ret void
+}
+
+;--- remote.s
+.globl f, remote_marker
+f:
+remote_marker:
+  ret
+
+;--- distributor.py
+import shutil
+import sys
+
+# Invoked as: distributor.py <object>|fail <input> <index> <output>
+mode, input, index, output = sys.argv[1:]
+if mode == "fail":
+    sys.exit(1)
+# The job's input and index must have been written before the executor runs.
+open(input, "rb").close()
+open(index, "rb").close()
+shutil.copyfile(mode, output)
@@ -0,0 +1,39 @@
+; REQUIRES: x86
+;; --thinlto-memory-budget= limits how many ThinLTO backend jobs run at once.
+;; Jobs larger than the budget still run, and the output does not change.
+
+; RUN: rm -rf %t && split-file %s %t && cd %t
+; RUN: opt -module-summary a.ll -o a.o
+; RUN: opt -module-summary b.ll -o b.o
+
+; RUN: ld.lld --thinlto-jobs=2 --thinlto-memory-budget=1 -save-temps -shared a.o b.o -o out.so
+; RUN: llvm-nm out.so1.lto.o | FileCheck %s --check-prefix=NM1
+; RUN: llvm-nm out.so2.lto.o | FileCheck %s --check-prefix=NM2
+
+; RUN: ld.lld --thinlto-jobs=2 --thinlto-memory-budget=4096 -shared a.o b.o -o big.so
+; RUN: llvm-nm big.so | FileCheck %s --check-prefixes=NM1,NM2
+
+; NM1: T f
+; NM2: T g
+
+; RUN: not ld.lld --thinlto-memory-budget=-1 -shared a.o b.o -o /dev/null 2>&1 | \
+; RUN:   FileCheck %s --check-prefix=ERR
+; ERR: error: --thinlto-memory-budget: expected a non-negative integer, but got -1
+
+;--- a.ll
+target datalayout = "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-f80:128-n8:16:32:64-S128"
+target triple = "x86_64-unknown-linux-gnu"
+
+define void @f() {
+entry:
+  ret void
+}
+
+;--- b.ll
+target datalayout = "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-f80:128-n8:16:32:64-S128"
+target triple = "x86_64-unknown-linux-gnu"
+
+define void @g() {
+entry:
+  ret void
+}
@@ -0,0 +1,53 @@
+# REQUIRES: x86
+## --skip-unchanged-link=<dir> skips the link if the command line and every
+## file the previous link read are unchanged, and the output is untouched.
+
+# RUN: rm -rf %t && split-file %s %t && cd %t
+# RUN: llvm-mc -filetype=obj -triple=x86_64 a.s -o a.o
+# RUN: llvm-mc -filetype=obj -triple=x86_64 b.s -o b.o
+# RUN: mkdir lib lib2 && llvm-ar rc lib/libb.a b.o
+
+# RUN: ld.lld --skip-unchanged-link=state --verbose a.o -Llib2 -Llib -lb \
+# RUN:   --call-graph-ordering-file=cg.txt -o out 2>&1 | FileCheck %s --check-prefix=LINK
+# RUN: ld.lld --skip-unchanged-link=state --verbose a.o -Llib2 -Llib -lb \
+# RUN:   --call-graph-ordering-file=cg.txt -o out 2>&1 | FileCheck %s --check-prefix=SKIP
+
+## A file that is read after the inputs have been loaded is also tracked.
+# RUN: echo '_start g 10' > cg.txt
+# RUN: ld.lld --skip-unchanged-link=state --verbose a.o -Llib2 -Llib -lb \
+# RUN:   --call-graph-ordering-file=cg.txt -o out 2>&1 | FileCheck %s --check-prefix=LINK
+# RUN: ld.lld --skip-unchanged-link=state --verbose a.o -Llib2 -Llib -lb \
+# RUN:   --call-graph-ordering-file=cg.txt -o out 2>&1 | FileCheck %s --check-prefix=SKIP
+
+## A library that appears in a search path changes what -lb resolves to.
+# RUN: ld.lld -shared b.o -o lib2/libb.so
+# RUN: ld.lld --skip-unchanged-link=state --verbose a.o -Llib2 -Llib -lb \
+# RUN:   --call-graph-ordering-file=cg.txt -o out 2>&1 | FileCheck %s --check-prefix=LINK
+# RUN: ld.lld --skip-unchanged-link=state --verbose a.o -Llib2 -Llib -lb \
+# RUN:   --call-graph-ordering-file=cg.txt -o out 2>&1 | FileCheck %s --check-prefix=SKIP
+# RUN: rm lib2/libb.so
+# RUN: ld.lld --skip-unchanged-link=state --verbose a.o -Llib2 -Llib -lb \
+# RUN:   --call-graph-ordering-file=cg.txt -o out 2>&1 | FileCheck %s --check-prefix=LINK
+
+## Modifying the output forces a relink.
+# RUN: echo > out
+# RUN: ld.lld --skip-unchanged-link=state --verbose a.o -Llib2 -Llib -lb \
+# RUN:   --call-graph-ordering-file=cg.txt -o out 2>&1 | FileCheck %s --check-prefix=LINK
+# RUN: llvm-readelf -h out | FileCheck %s --check-prefix=ELF
+
+# LINK-NOT: is up to date
+# SKIP: --skip-unchanged-link: out is up to date
+# ELF: Type: EXEC
+
+#--- a.s
+.globl _start
+_start:
+  call g
+
+#--- b.s
+.globl g
+g:
+  ret
+
+#--- cg.txt
+_start g 1
@@ -0,0 +1,40 @@
+# REQUIRES: x86
+# UNSUPPORTED: system-windows
+## --threads=jobserver runs as many tasks at a time as the jobserver described
+## by MAKEFLAGS allows, and ignores a jobserver that can't be used.
+
+# RUN: rm -rf %t && mkdir %t && cd %t
+# RUN: llvm-mc -filetype=obj -triple=x86_64 %s -o a.o
+
+# RUN: ld.lld --threads=jobserver a.o -o out
+# RUN: llvm-readelf -S out | FileCheck %s
+
+## With no tokens in the jobserver, every task runs in the implicit job slot.
+# RUN: mkfifo jobs
+# RUN: env MAKEFLAGS="-j1 --jobserver-auth=fifo:jobs" ld.lld --threads=jobserver a.o -o out
+# RUN: llvm-readelf -S out | FileCheck %s
+
+## Descriptors that are not open, and a path that is not a named pipe, are not
+## used as a jobserver.
+# RUN: env MAKEFLAGS="-j4 --jobserver-auth=98,99" ld.lld --threads=jobserver a.o -o out
+# RUN: llvm-readelf -S out | FileCheck %s
+# RUN: env MAKEFLAGS="-j4 --jobserver-auth=fifo:a.o" ld.lld --threads=jobserver a.o -o out
+# RUN: llvm-readelf -S out | FileCheck %s
+
+# CHECK: sec_a
+# CHECK: sec_b
+# CHECK: sec_c
+# CHECK: sec_d
+
+.globl _start
+_start:
+  ret
+
+.section sec_a,"ax"
+  nop
+.section sec_b,"ax"
+  nop
+.section sec_c,"ax"
+  nop
+.section sec_d,"ax"
+  nop
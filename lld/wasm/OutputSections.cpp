@@ -66,6 +66,11 @@ void CodeSection::finalizeContents() {
 }
 
 void CodeSection::writeTo(uint8_t *buf) {
+  parallel::TaskGroup tg;
+  writeTo(buf, tg);
+}
+
+void CodeSection::writeTo(uint8_t *buf, parallel::TaskGroup &tg) {
   log("writing " + toString(*this) + " offset=" + Twine(offset) +
       " size=" + Twine(getSize()));
   log(" headersize=" + Twine(header.size()));
@@ -79,9 +84,23 @@ void CodeSection::writeTo(uint8_t *buf) {
   // Write code section headers
   memcpy(buf, codeSectionHeader.data(), codeSectionHeader.size());
 
-  // Write code section bodies
-  for (const InputChunk *chunk : functions)
-    chunk->writeTo(buf);
+  // Write code section bodies. Split the functions into batches of roughly
+  // taskSizeLimit bytes so that large code sections are relocated in
+  // parallel without creating one task per function.
+  const size_t taskSizeLimit = 4 << 20;
+  size_t begin = 0, taskSize = 0;
+  for (size_t i = 0, e = functions.size(); i != e; ++i) {
+    taskSize += functions[i]->getSize();
+    if (taskSize < taskSizeLimit && i + 1 != e)
+      continue;
+    ArrayRef<InputFunction *> batch = functions.slice(begin, i + 1 - begin);
+    tg.spawn([=] {
+      for (const InputChunk *chunk : batch)
+        chunk->writeTo(buf);
+    });
+    begin = i + 1;
+    taskSize = 0;
+  }
 }
 
 uint32_t CodeSection::getNumRelocations() const {
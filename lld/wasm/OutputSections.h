@@ -14,6 +14,7 @@
 #include "lld/Common/ErrorHandler.h"
 #include "lld/Common/LLVM.h"
 #include "llvm/ADT/DenseMap.h"
+#include "llvm/Support/Parallel.h"
 
 namespace lld {
 
@@ -64,6 +65,9 @@ public:
 
   size_t getSize() const override { return header.size() + bodySize; }
   void writeTo(uint8_t *buf) override;
+  // Like writeTo(buf), but function bodies are written (and relocated) by
+  // tasks spawned on `tg`.
+  void writeTo(uint8_t *buf, llvm::parallel::TaskGroup &tg);
   uint32_t getNumRelocations() const override;
   void writeRelocations(raw_ostream &os) const override;
   bool isNeeded() const override { return functions.size() > 0; }
@@ -219,10 +219,16 @@ void Writer::writeHeader() {
 
 void Writer::writeSections() {
   uint8_t *buf = buffer->getBufferStart();
-  parallelForEach(outputSections, [buf](OutputSection *s) {
+  // The code section is usually by far the largest one, so rather than writing
+  // it as a single task, let it spawn tasks for batches of functions.
+  parallel::TaskGroup tg;
+  for (OutputSection *s : outputSections) {
     assert(s->isNeeded());
-    s->writeTo(buf);
-  });
+    if (auto *code = dyn_cast<CodeSection>(s))
+      code->writeTo(buf, tg);
+    else
+      tg.spawn([=] { s->writeTo(buf); });
+  }
 }
 
 // Computes a hash value of Data using a given hash function.
@@ -136,6 +136,18 @@ public:
   //     condition has been set.
   const char *GetConditionText(size_t *hash = nullptr) const;
 
+  /// Evaluate the condition of this location in \p exe_ctx.
+  ///
+  /// The condition is evaluated by the debugger after the inferior has
+  /// already stopped, so every hit costs a stop and a resume however cheap
+  /// the condition is. Parsing is paid only once: the parsed expression is
+  /// kept and reused while the condition text is unchanged and the
+  /// expression stays valid for the new context.
+  ///
+  /// \return
+  ///     \b true if the condition says to stop. When the condition could not
+  ///     be parsed or evaluated \p error is set and the result is not
+  ///     meaningful.
   bool ConditionSaysStop(ExecutionContext &exe_ctx, Status &error);
 
   /// Set the valid thread to be checked when the breakpoint is hit.
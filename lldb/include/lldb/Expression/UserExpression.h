@@ -224,6 +224,13 @@ public:
   /// Evaluate one expression in the scratch context of the target passed in
   /// the exe_ctx and return its result.
   ///
+  /// Every call parses, and if needed JITs, the expression from scratch; no
+  /// compiled expression is kept between calls. Callers that evaluate the
+  /// same text repeatedly in the same context, like breakpoint conditions,
+  /// should instead hold on to the UserExpression returned by
+  /// Target::GetUserExpressionForLanguage and re-Execute it while
+  /// IsParseCacheable() and MatchesContext() allow.
+  ///
   /// \param[in] exe_ctx
   ///     The execution context to use when evaluating the expression.
   ///
@@ -63,6 +63,10 @@ private:
   const MemoryCache &operator=(const MemoryCache &) = delete;
 
   lldb::DataBufferSP GetL2CacheLine(lldb::addr_t addr, Status &error);
+
+  /// Read the two adjacent, uncached L2 cache lines starting at \p addr with
+  /// a single read from the inferior, and add whatever was read to the cache.
+  void PrefetchL2CacheLinePair(lldb::addr_t addr);
 };
 
     
@@ -108,6 +108,10 @@ public:
   std::optional<uint64_t> GetHeaderDWOId() { return m_header.GetDWOId(); }
   void ExtractUnitDIEIfNeeded();
   void ExtractUnitDIENoDwoIfNeeded();
+  /// Extract every DIE of the unit. The DIEs are stored in one flat array
+  /// whose parent and sibling links are array indices, so a subtree cannot be
+  /// parsed on its own. The array is only freed by a ScopedExtractDIEs that
+  /// extracted it, because DWARFDIEs handed out are pointers into it.
   void ExtractDIEsIfNeeded();
 
   class ScopedExtractDIEs {
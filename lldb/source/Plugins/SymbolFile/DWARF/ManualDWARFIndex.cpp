@@ -84,13 +84,31 @@ void ManualDWARFIndex::Index() {
   // caused us to load the unit's DIEs.
   std::vector<std::optional<DWARFUnit::ScopedExtractDIEs>> clear_cu_dies(
       units_to_index.size());
+  std::vector<std::vector<DWARFUnit::ScopedExtractDIEs>> clear_dwo_dies(
+      units_to_index.size());
   auto parser_fn = [&](size_t cu_idx) {
     IndexUnit(*units_to_index[cu_idx], dwp_dwarf, sets[cu_idx]);
     progress.Increment();
   };
 
   auto extract_fn = [&](size_t cu_idx) {
-    clear_cu_dies[cu_idx] = units_to_index[cu_idx]->ExtractDIEsScoped();
+    DWARFUnit &unit = *units_to_index[cu_idx];
+    clear_cu_dies[cu_idx] = unit.ExtractDIEsScoped();
+    // Clearing the DIEs of a skeleton unit also clears those of its .dwo
+    // compile unit, but a standalone .dwo file may contain type units as well,
+    // which IndexUnit indexes too. Load them here so that their DIEs are
+    // released after indexing instead of staying in memory for every .dwo.
+    if (unit.GetDWOId()) {
+      SymbolFileDWARFDwo *dwo_symbol_file = unit.GetDwoSymbolFile();
+      if (dwo_symbol_file && dwo_symbol_file != dwp_dwarf) {
+        DWARFUnit *dwo_cu = &unit.GetNonSkeletonUnit();
+        DWARFDebugInfo &dwo_info = dwo_symbol_file->DebugInfo();
+        for (size_t i = 0; i < dwo_info.GetNumUnits(); ++i)
+          if (DWARFUnit *dwo_unit = dwo_info.GetUnitAtIndex(i);
+              dwo_unit != dwo_cu)
+            clear_dwo_dies[cu_idx].push_back(dwo_unit->ExtractDIEsScoped());
+      }
+    }
     progress.Increment();
   };
 
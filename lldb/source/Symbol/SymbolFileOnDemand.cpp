@@ -9,6 +9,7 @@
 #include "lldb/Symbol/SymbolFileOnDemand.h"
 
 #include "lldb/Core/Module.h"
+#include "lldb/Core/Progress.h"
 #include "lldb/Symbol/SymbolFile.h"
 
 #include <memory>
@@ -560,6 +561,12 @@ void SymbolFileOnDemand::SetLoadDebugInfoEnabled() {
   if (m_debug_info_enabled)
     return;
   LLDB_LOG(GetLog(), "[{0}] Hydrate debug info", GetSymbolFileName());
+  // Hydration runs on the thread whose query needed the debug info, and with
+  // symbol preloading it can index the whole module. Report it so that a
+  // stall while, say, building the first backtrace is attributed to the
+  // module being loaded. Hydrating in the background would need
+  // m_debug_info_enabled and the forwarding below to be made thread safe.
+  Progress progress("Loading debug info", GetSymbolFileName().AsCString(""));
   m_debug_info_enabled = true;
   InitializeObject();
   if (m_preload_symbols)
@@ -6,10 +6,12 @@
 //
 //===----------------------------------------------------------------------===//
 
+#include <algorithm>
 #include <map>
 #include <set>
 
 #include "lldb/Core/DataFileCache.h"
+#include "lldb/Core/Debugger.h"
 #include "lldb/Core/Module.h"
 #include "lldb/Core/RichManglingContext.h"
 #include "lldb/Core/Section.h"
@@ -27,6 +29,7 @@
 #include "llvm/ADT/ArrayRef.h"
 #include "llvm/ADT/StringRef.h"
 #include "llvm/Support/DJB.h"
+#include "llvm/Support/ThreadPool.h"
 
 using namespace lldb;
 using namespace lldb_private;
@@ -309,6 +312,34 @@ void Symtab::InitNameIndexes() {
     std::vector<std::pair<NameToIndexMap::Entry, const char *>> backlog;
     backlog.reserve(num_symbols / 2);
 
+    // Demangle the names that the loop below needs in full up front, on the
+    // debugger's thread pool. Each symbol caches its own demangled name and
+    // the string pool is thread safe, so the loop then only reads the cached
+    // names. Code symbols are skipped since they usually go through the rich
+    // mangling info instead.
+    constexpr uint32_t block_size = 4096;
+    if (num_symbols > block_size) {
+      auto demangle_fn = [this, num_symbols](uint32_t begin) {
+        uint32_t end = std::min<size_t>(begin + block_size, num_symbols);
+        for (uint32_t value = begin; value < end; ++value) {
+          Symbol &symbol = m_symbols[value];
+          if (symbol.IsTrampoline() ||
+              symbol.IsSyntheticWithAutoGeneratedName())
+            continue;
+          const SymbolType type = symbol.GetType();
+          if (type == eSymbolTypeCode || type == eSymbolTypeResolver)
+            continue;
+          Mangled &mangled = symbol.GetMangled();
+          if (mangled.GetMangledName())
+            mangled.GetDemangledName();
+        }
+      };
+      llvm::ThreadPoolTaskGroup task_group(Debugger::GetThreadPool());
+      for (uint32_t begin = 0; begin < num_symbols; begin += block_size)
+        task_group.async(demangle_fn, begin);
+      task_group.wait();
+    }
+
     // Instantiation of the demangler is expensive, so better use a single one
     // for all entries during batch processing.
     RichManglingContext rmc;
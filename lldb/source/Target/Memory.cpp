@@ -14,6 +14,7 @@
 #include "lldb/Utility/RangeMap.h"
 #include "lldb/Utility/State.h"
 
+#include <algorithm>
 #include <cinttypes>
 #include <memory>
 
@@ -151,6 +152,34 @@ lldb::DataBufferSP MemoryCache::GetL2CacheLine(lldb::addr_t line_base_addr,
   return data_buffer_heap_sp;
 }
 
+void MemoryCache::PrefetchL2CacheLinePair(lldb::addr_t line_base_addr) {
+  assert((line_base_addr % m_L2_cache_line_byte_size) == 0);
+
+  std::lock_guard<std::recursive_mutex> guard(m_mutex);
+  const addr_t second_line_addr = line_base_addr + m_L2_cache_line_byte_size;
+  if (m_L2_cache.count(line_base_addr) || m_L2_cache.count(second_line_addr))
+    return;
+
+  // Any failure here is left for GetL2CacheLine to rediscover and report,
+  // one line at a time.
+  Status error;
+  DataBufferHeap buffer(2 * m_L2_cache_line_byte_size, 0);
+  size_t bytes_read = m_process.ReadMemoryFromInferior(
+      line_base_addr, buffer.GetBytes(), buffer.GetByteSize(), error);
+  if (bytes_read == 0)
+    return;
+
+  addr_t line_addr = line_base_addr;
+  for (size_t offset = 0; offset < bytes_read;
+       offset += m_L2_cache_line_byte_size) {
+    size_t line_size = std::min<size_t>(m_L2_cache_line_byte_size,
+                                        bytes_read - offset);
+    m_L2_cache[line_addr] =
+        std::make_shared<DataBufferHeap>(buffer.GetBytes() + offset, line_size);
+    line_addr += m_L2_cache_line_byte_size;
+  }
+}
+
 size_t MemoryCache::Read(addr_t addr, void *dst, size_t dst_len,
                          Status &error) {
   if (!dst || dst_len == 0)
@@ -205,6 +234,12 @@ size_t MemoryCache::Read(addr_t addr, void *dst, size_t dst_len,
   // We're going to have all of our loads and reads be cache line aligned.
   addr_t cache_line_offset = addr % m_L2_cache_line_byte_size;
   addr_t cache_line_base_addr = addr - cache_line_offset;
+  // If the read straddles two cache lines that are both missing, fetch them
+  // together so that a high latency connection only pays for one round trip.
+  if (cache_line_offset + dst_len > m_L2_cache_line_byte_size &&
+      !m_invalid_ranges.FindEntryThatContains(cache_line_base_addr +
+                                              m_L2_cache_line_byte_size))
+    PrefetchL2CacheLinePair(cache_line_base_addr);
   DataBufferSP first_cache_line = GetL2CacheLine(cache_line_base_addr, error);
   // If we get nothing, then the read to the inferior likely failed. Nothing to
   // do here.
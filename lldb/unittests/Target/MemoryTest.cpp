@@ -40,7 +40,7 @@ public:
 class DummyProcess : public Process {
 public:
   DummyProcess(lldb::TargetSP target_sp, lldb::ListenerSP listener_sp)
-      : Process(target_sp, listener_sp), m_bytes_left(0) {}
+      : Process(target_sp, listener_sp), m_bytes_left(0), m_num_reads(0) {}
 
   // Required overrides
   bool CanDebug(lldb::TargetSP target, bool plugin_specified_by_name) override {
@@ -50,6 +50,7 @@ public:
   void RefreshStateAfterStop() override {}
   size_t DoReadMemory(lldb::addr_t vm_addr, void *buf, size_t size,
                       Status &error) override {
+    ++m_num_reads;
     if (m_bytes_left == 0)
       return 0;
 
@@ -72,6 +73,7 @@ public:
 
   // Test-specific additions
   size_t m_bytes_left;
+  size_t m_num_reads;
   MemoryCache &GetMemoryCache() { return m_memory_cache; }
   void SetMaxReadSize(size_t size) { m_bytes_left = size; }
 };
@@ -225,4 +227,15 @@ TEST_F(MemoryTest, TesetMemoryCacheRead) {
   ASSERT_TRUE(process->m_bytes_left == l2_cache_size); // Verify that we re-read
                                                        // instead of using an
                                                        // old cache
+
+  // Straddling 2 cache lines that are both missing should fill them with a
+  // single read from the inferior.
+  process->SetMaxReadSize(l2_cache_size * 2);
+  process->m_num_reads = 0;
+  data_sp->SetByteSize(l2_cache_size);
+  bytes_read = mem_cache.Read(0x8001, data_sp->GetBytes(),
+                              data_sp->GetByteSize(), error);
+  ASSERT_TRUE(bytes_read == l2_cache_size);
+  ASSERT_TRUE(process->m_bytes_left == 0);
+  ASSERT_TRUE(process->m_num_reads == 1);
 }
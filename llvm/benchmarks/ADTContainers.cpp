@@ -0,0 +1,84 @@
+#include "benchmark/benchmark.h"
+#include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/SmallVector.h"
+#include "llvm/ADT/StringMap.h"
+#include <string>
+#include <vector>
+
+using namespace llvm;
+
+static void BM_DenseMapInsert(benchmark::State &state) {
+  const unsigned N = state.range(0);
+  for (auto _ : state) {
+    DenseMap<unsigned, unsigned> Map;
+    for (unsigned I = 0; I != N; ++I)
+      Map[I * 37] = I;
+    benchmark::DoNotOptimize(Map.size());
+  }
+  state.SetItemsProcessed(state.iterations() * N);
+}
+BENCHMARK(BM_DenseMapInsert)->Range(64, 64 << 10);
+
+static void BM_DenseMapLookup(benchmark::State &state) {
+  const unsigned N = state.range(0);
+  DenseMap<unsigned, unsigned> Map;
+  for (unsigned I = 0; I != N; ++I)
+    Map[I * 37] = I;
+  for (auto _ : state) {
+    unsigned Found = 0;
+    for (unsigned I = 0; I != N; ++I)
+      Found += Map.count(I * 37 + (I & 1));
+    benchmark::DoNotOptimize(Found);
+  }
+  state.SetItemsProcessed(state.iterations() * N);
+}
+BENCHMARK(BM_DenseMapLookup)->Range(64, 64 << 10);
+
+static std::vector<std::string> makeKeys(unsigned N) {
+  std::vector<std::string> Keys;
+  Keys.reserve(N);
+  for (unsigned I = 0; I != N; ++I)
+    Keys.push_back("_ZN4llvm6detail" + std::to_string(I * 7919));
+  return Keys;
+}
+
+static void BM_StringMapInsert(benchmark::State &state) {
+  const std::vector<std::string> Keys = makeKeys(state.range(0));
+  for (auto _ : state) {
+    StringMap<unsigned> Map;
+    for (const std::string &Key : Keys)
+      Map.try_emplace(Key, 0);
+    benchmark::DoNotOptimize(Map.size());
+  }
+  state.SetItemsProcessed(state.iterations() * Keys.size());
+}
+BENCHMARK(BM_StringMapInsert)->Range(64, 64 << 10);
+
+static void BM_StringMapLookup(benchmark::State &state) {
+  const std::vector<std::string> Keys = makeKeys(state.range(0));
+  StringMap<unsigned> Map;
+  for (const std::string &Key : Keys)
+    Map.try_emplace(Key, 0);
+  for (auto _ : state) {
+    unsigned Found = 0;
+    for (const std::string &Key : Keys)
+      Found += Map.count(Key);
+    benchmark::DoNotOptimize(Found);
+  }
+  state.SetItemsProcessed(state.iterations() * Keys.size());
+}
+BENCHMARK(BM_StringMapLookup)->Range(64, 64 << 10);
+
+static void BM_SmallVectorGrow(benchmark::State &state) {
+  const unsigned N = state.range(0);
+  for (auto _ : state) {
+    SmallVector<unsigned, 8> Vec;
+    for (unsigned I = 0; I != N; ++I)
+      Vec.push_back(I);
+    benchmark::DoNotOptimize(Vec.data());
+  }
+  state.SetItemsProcessed(state.iterations() * N);
+}
+BENCHMARK(BM_SmallVectorGrow)->Range(8, 8 << 10);
+
+BENCHMARK_MAIN();
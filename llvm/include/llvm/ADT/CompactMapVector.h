@@ -0,0 +1,387 @@
+//===- llvm/ADT/CompactMapVector.h - Compact ordered map -------*- C++ -*-===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// This file implements CompactMapVector, a map with insertion order iteration
+/// that is laid out like an "ordered dict": the key/value pairs live densely in
+/// a SmallVector and the hash table only holds 32-bit indices into it.
+///
+/// Compared to MapVector each key is stored once instead of twice, and
+/// compared to DenseMap the mostly-empty part of the table costs 4 bytes per
+/// bucket instead of sizeof(std::pair<KeyT, ValueT>). This makes it a good fit
+/// for large pointer-keyed tables such as DenseMap<const Value *, unsigned>.
+/// Lookups take one extra indirection to compare the key.
+///
+//===----------------------------------------------------------------------===//
+
+#ifndef LLVM_ADT_COMPACTMAPVECTOR_H
+#define LLVM_ADT_COMPACTMAPVECTOR_H
+
+#include "llvm/ADT/ArrayRef.h"
+#include "llvm/ADT/DenseMapInfo.h"
+#include "llvm/ADT/SmallVector.h"
+#include "llvm/Support/MathExtras.h"
+#include "llvm/Support/MemAlloc.h"
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace llvm {
+
+/// This class implements a map that provides access to all stored values in
+/// insertion order. The values are kept in a SmallVector<*, 0> and the mapping
+/// is done with an open-addressing table of 32-bit indices into that vector.
+/// Unlike DenseMap, KeyInfoT only needs to provide getHashValue() and
+/// isEqual(); no empty or tombstone keys are reserved.
+template <typename KeyT, typename ValueT,
+          typename KeyInfoT = DenseMapInfo<KeyT>>
+class CompactMapVector {
+  using IndexT = uint32_t;
+  using VectorType = SmallVector<std::pair<KeyT, ValueT>, 0>;
+
+  static constexpr IndexT EmptyIndex = ~IndexT(0);
+  static constexpr IndexT TombstoneIndex = ~IndexT(0) - 1;
+
+  VectorType Vector;
+  IndexT *Indices = nullptr;
+  unsigned NumIndices = 0;
+  unsigned NumTombstones = 0;
+
+public:
+  using key_type = KeyT;
+  using mapped_type = ValueT;
+  using value_type = typename VectorType::value_type;
+  using size_type = typename VectorType::size_type;
+
+  using iterator = typename VectorType::iterator;
+  using const_iterator = typename VectorType::const_iterator;
+  using reverse_iterator = typename VectorType::reverse_iterator;
+  using const_reverse_iterator = typename VectorType::const_reverse_iterator;
+
+  CompactMapVector() = default;
+  CompactMapVector(const CompactMapVector &Other) : Vector(Other.Vector) {
+    if (Other.NumIndices)
+      rebuild(Other.NumIndices);
+  }
+  CompactMapVector(CompactMapVector &&Other)
+      : Vector(std::move(Other.Vector)), Indices(Other.Indices),
+        NumIndices(Other.NumIndices), NumTombstones(Other.NumTombstones) {
+    Other.Vector.clear();
+    Other.Indices = nullptr;
+    Other.NumIndices = Other.NumTombstones = 0;
+  }
+  ~CompactMapVector() { freeIndices(); }
+
+  CompactMapVector &operator=(const CompactMapVector &Other) {
+    if (this != &Other) {
+      CompactMapVector Tmp(Other);
+      swap(Tmp);
+    }
+    return *this;
+  }
+  CompactMapVector &operator=(CompactMapVector &&Other) {
+    CompactMapVector Tmp(std::move(Other));
+    swap(Tmp);
+    return *this;
+  }
+
+  /// Clear the CompactMapVector and return the underlying vector.
+  VectorType takeVector() {
+    freeIndices();
+    return std::move(Vector);
+  }
+
+  size_type size() const { return Vector.size(); }
+
+  /// Grow the CompactMapVector so that it can contain at least \p NumEntries
+  /// items before resizing again.
+  void reserve(size_type NumEntries) {
+    Vector.reserve(NumEntries);
+    unsigned NewNumIndices = getMinIndicesForEntries(NumEntries);
+    if (NewNumIndices > NumIndices)
+      rebuild(NewNumIndices);
+  }
+
+  iterator begin() { return Vector.begin(); }
+  const_iterator begin() const { return Vector.begin(); }
+  iterator end() { return Vector.end(); }
+  const_iterator end() const { return Vector.end(); }
+
+  reverse_iterator rbegin() { return Vector.rbegin(); }
+  const_reverse_iterator rbegin() const { return Vector.rbegin(); }
+  reverse_iterator rend() { return Vector.rend(); }
+  const_reverse_iterator rend() const { return Vector.rend(); }
+
+  bool empty() const { return Vector.empty(); }
+
+  value_type &front() { return Vector.front(); }
+  const value_type &front() const { return Vector.front(); }
+  value_type &back() { return Vector.back(); }
+  const value_type &back() const { return Vector.back(); }
+
+  void clear() {
+    Vector.clear();
+    NumTombstones = 0;
+    if (NumIndices)
+      std::memset(Indices, 0xff, NumIndices * sizeof(IndexT));
+  }
+
+  void swap(CompactMapVector &RHS) {
+    std::swap(Vector, RHS.Vector);
+    std::swap(Indices, RHS.Indices);
+    std::swap(NumIndices, RHS.NumIndices);
+    std::swap(NumTombstones, RHS.NumTombstones);
+  }
+
+  ValueT &operator[](const KeyT &Key) { return try_emplace(Key).first->second; }
+  ValueT &operator[](KeyT &&Key) {
+    return try_emplace(std::move(Key)).first->second;
+  }
+
+  // Returns a copy of the value.  Only allowed if ValueT is copyable.
+  ValueT lookup(const KeyT &Key) const {
+    static_assert(std::is_copy_constructible_v<ValueT>,
+                  "Cannot call lookup() if ValueT is not copyable.");
+    const_iterator Pos = find(Key);
+    return Pos == end() ? ValueT() : Pos->second;
+  }
+
+  template <typename... Ts>
+  std::pair<iterator, bool> try_emplace(const KeyT &Key, Ts &&...Args) {
+    IndexT *Slot = findSlotForInsert(Key);
+    if (*Slot < TombstoneIndex)
+      return std::make_pair(begin() + *Slot, false);
+    setSlot(Slot);
+    Vector.emplace_back(std::piecewise_construct, std::forward_as_tuple(Key),
+                        std::forward_as_tuple(std::forward<Ts>(Args)...));
+    return std::make_pair(std::prev(end()), true);
+  }
+  template <typename... Ts>
+  std::pair<iterator, bool> try_emplace(KeyT &&Key, Ts &&...Args) {
+    IndexT *Slot = findSlotForInsert(Key);
+    if (*Slot < TombstoneIndex)
+      return std::make_pair(begin() + *Slot, false);
+    setSlot(Slot);
+    Vector.emplace_back(std::piecewise_construct,
+                        std::forward_as_tuple(std::move(Key)),
+                        std::forward_as_tuple(std::forward<Ts>(Args)...));
+    return std::make_pair(std::prev(end()), true);
+  }
+
+  std::pair<iterator, bool> insert(const std::pair<KeyT, ValueT> &KV) {
+    return try_emplace(KV.first, KV.second);
+  }
+  std::pair<iterator, bool> insert(std::pair<KeyT, ValueT> &&KV) {
+    return try_emplace(std::move(KV.first), std::move(KV.second));
+  }
+
+  template <typename V>
+  std::pair<iterator, bool> insert_or_assign(const KeyT &Key, V &&Val) {
+    auto Ret = try_emplace(Key, std::forward<V>(Val));
+    if (!Ret.second)
+      Ret.first->second = std::forward<V>(Val);
+    return Ret;
+  }
+  template <typename V>
+  std::pair<iterator, bool> insert_or_assign(KeyT &&Key, V &&Val) {
+    auto Ret = try_emplace(std::move(Key), std::forward<V>(Val));
+    if (!Ret.second)
+      Ret.first->second = std::forward<V>(Val);
+    return Ret;
+  }
+
+  bool contains(const KeyT &Key) const { return findSlot(Key) != nullptr; }
+
+  size_type count(const KeyT &Key) const { return contains(Key) ? 1 : 0; }
+
+  iterator find(const KeyT &Key) {
+    const IndexT *Slot = findSlot(Key);
+    return Slot ? begin() + *Slot : end();
+  }
+
+  const_iterator find(const KeyT &Key) const {
+    const IndexT *Slot = findSlot(Key);
+    return Slot ? begin() + *Slot : end();
+  }
+
+  /// Remove the last element from the vector.
+  void pop_back() {
+    killSlot(Vector.back().first);
+    Vector.pop_back();
+  }
+
+  /// Remove the element given by Iterator.
+  ///
+  /// Returns an iterator to the element following the one which was removed,
+  /// which may be end().
+  ///
+  /// \note This is a deceivingly expensive operation (linear time).  It's
+  /// usually better to use \a remove_if() if possible.
+  iterator erase(iterator Iterator) {
+    IndexT Index = Iterator - begin();
+    killSlot(Iterator->first);
+    auto Next = Vector.erase(Iterator);
+    if (Next == Vector.end())
+      return Next;
+
+    // Update indices in the table.
+    for (IndexT &I : indices()) {
+      assert(I != Index && "Index was already erased!");
+      if (I > Index && I < TombstoneIndex)
+        --I;
+    }
+    return Next;
+  }
+
+  /// Remove all elements with the key value Key.
+  ///
+  /// Returns the number of elements removed.
+  size_type erase(const KeyT &Key) {
+    auto Iterator = find(Key);
+    if (Iterator == end())
+      return 0;
+    erase(Iterator);
+    return 1;
+  }
+
+  /// Remove the elements that match the predicate.
+  ///
+  /// Erase all elements that match \c Pred in a single pass.  Takes linear
+  /// time.
+  template <class Predicate> void remove_if(Predicate Pred) {
+    auto O = Vector.begin();
+    for (auto I = O, E = Vector.end(); I != E; ++I) {
+      if (Pred(*I))
+        continue;
+      if (I != O)
+        *O = std::move(*I);
+      ++O;
+    }
+    if (O == Vector.end())
+      return;
+    Vector.erase(O, Vector.end());
+    rebuild(NumIndices);
+  }
+
+  /// Return the approximate size (in bytes) of the actual map.
+  /// This is just the raw memory used by the vector and the index table.
+  size_t getMemorySize() const {
+    return Vector.capacity_in_bytes() + NumIndices * sizeof(IndexT);
+  }
+
+private:
+  MutableArrayRef<IndexT> indices() {
+    return MutableArrayRef<IndexT>(Indices, NumIndices);
+  }
+
+  static unsigned getMinIndicesForEntries(unsigned NumEntries) {
+    // Ensure that "NumEntries * 4 < NumIndices * 3".
+    if (NumEntries == 0)
+      return 0;
+    return NextPowerOf2(NumEntries * 4 / 3 + 1);
+  }
+
+  void freeIndices() {
+    if (Indices)
+      deallocate_buffer(Indices, NumIndices * sizeof(IndexT), alignof(IndexT));
+    Indices = nullptr;
+    NumIndices = NumTombstones = 0;
+  }
+
+  /// Replace the index table with an empty one of \p NewNumIndices buckets and
+  /// reinsert every element of the vector.
+  void rebuild(unsigned NewNumIndices) {
+    assert(isPowerOf2_32(NewNumIndices) && "Table size must be a power of 2");
+    assert(Vector.size() < TombstoneIndex && "Too many elements");
+    freeIndices();
+    NumIndices = NewNumIndices;
+    Indices = static_cast<IndexT *>(
+        allocate_buffer(NumIndices * sizeof(IndexT), alignof(IndexT)));
+    std::memset(Indices, 0xff, NumIndices * sizeof(IndexT));
+
+    unsigned Mask = NumIndices - 1;
+    for (IndexT Idx = 0, E = Vector.size(); Idx != E; ++Idx) {
+      unsigned Bucket = KeyInfoT::getHashValue(Vector[Idx].first) & Mask;
+      unsigned ProbeAmt = 1;
+      while (Indices[Bucket] != EmptyIndex)
+        Bucket = (Bucket + ProbeAmt++) & Mask;
+      Indices[Bucket] = Idx;
+    }
+  }
+
+  /// Return the slot holding the index of \p Key, or null if it is not in the
+  /// map.
+  const IndexT *findSlot(const KeyT &Key) const {
+    if (NumIndices == 0)
+      return nullptr;
+    unsigned Mask = NumIndices - 1;
+    unsigned Bucket = KeyInfoT::getHashValue(Key) & Mask;
+    unsigned ProbeAmt = 1;
+    while (true) {
+      IndexT Idx = Indices[Bucket];
+      if (Idx == EmptyIndex)
+        return nullptr;
+      if (Idx != TombstoneIndex && KeyInfoT::isEqual(Vector[Idx].first, Key))
+        return &Indices[Bucket];
+      Bucket = (Bucket + ProbeAmt++) & Mask;
+    }
+  }
+
+  /// Return the slot holding the index of \p Key if it is in the map.
+  /// Otherwise, make sure there is room for one more element and return the
+  /// slot its index should go to.
+  IndexT *findSlotForInsert(const KeyT &Key) {
+    if (const IndexT *Slot = findSlot(Key))
+      return const_cast<IndexT *>(Slot);
+
+    // Grow if the table would become more than 3/4 full, counting tombstones.
+    // If mostly tombstones are in the way, rebuilding at the same size is
+    // enough.
+    if ((Vector.size() + NumTombstones + 1) * 4 >= NumIndices * 3) {
+      unsigned NewNumIndices = getMinIndicesForEntries(Vector.size() + 1);
+      rebuild(std::max(NewNumIndices, NumIndices));
+    }
+
+    unsigned Mask = NumIndices - 1;
+    unsigned Bucket = KeyInfoT::getHashValue(Key) & Mask;
+    unsigned ProbeAmt = 1;
+    IndexT *FoundTombstone = nullptr;
+    while (true) {
+      IndexT &Idx = Indices[Bucket];
+      if (Idx == EmptyIndex)
+        return FoundTombstone ? FoundTombstone : &Idx;
+      if (Idx == TombstoneIndex && !FoundTombstone)
+        FoundTombstone = &Idx;
+      Bucket = (Bucket + ProbeAmt++) & Mask;
+    }
+  }
+
+  /// Point the free \p Slot at the element about to be appended to the vector.
+  void setSlot(IndexT *Slot) {
+    assert(Vector.size() < TombstoneIndex && "Too many elements");
+    if (*Slot == TombstoneIndex)
+      --NumTombstones;
+    *Slot = Vector.size();
+  }
+
+  /// Replace the index of \p Key, which must be in the map, by a tombstone.
+  void killSlot(const KeyT &Key) {
+    IndexT *Slot = const_cast<IndexT *>(findSlot(Key));
+    assert(Slot && "Key is not in the map");
+    *Slot = TombstoneIndex;
+    ++NumTombstones;
+  }
+};
+
+} // end namespace llvm
+
+#endif // LLVM_ADT_COMPACTMAPVECTOR_H
@@ -612,6 +612,10 @@ public:
       if (!entry)
         break;
       for (TreeTy *T = entry ; T != nullptr; T = T->next) {
+        // The bucket also holds trees whose digest differs in a masked bit,
+        // and those cannot have the same contents.
+        if (T->computeDigest() != digest)
+          continue;
         // Compare the Contents('T') with Contents('TNew')
         typename TreeTy::iterator TI = T->begin(), TE = T->end();
         if (!compareTreeWithSection(TNew, TI, TE))
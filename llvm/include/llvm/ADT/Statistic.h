@@ -47,6 +47,46 @@ class raw_ostream;
 class raw_fd_ostream;
 class StringRef;
 
+namespace detail {
+/// Each thread's statistic counters are allocated in chunks of this many
+/// counters, which never move once allocated.
+constexpr unsigned StatisticCounterChunkSize = 256;
+constexpr unsigned MaxStatisticCounterChunks = 256;
+
+using StatisticCounterChunks =
+    std::atomic<std::atomic<uint64_t> *>[MaxStatisticCounterChunks];
+
+/// Return the current thread's counter for the statistic with the given
+/// counter index, allocating the current thread's counters if needed.
+std::atomic<uint64_t> &getThreadStatisticCounterSlow(unsigned Index);
+
+#ifdef _WIN32
+// Direct access to thread_local variables from a different DLL isn't
+// possible with Windows Native TLS.
+std::atomic<uint64_t> &getThreadStatisticCounter(unsigned Index);
+#else
+// Don't access this directly, use getThreadStatisticCounter.
+extern thread_local StatisticCounterChunks *ThreadStatisticCounterChunks;
+
+/// Return the current thread's counter for the statistic with the given
+/// counter index.
+inline std::atomic<uint64_t> &getThreadStatisticCounter(unsigned Index) {
+  if (StatisticCounterChunks *Chunks = ThreadStatisticCounterChunks)
+    if (std::atomic<uint64_t> *Chunk =
+            (*Chunks)[Index / StatisticCounterChunkSize].load(
+                std::memory_order_relaxed))
+      return Chunk[Index % StatisticCounterChunkSize];
+  return getThreadStatisticCounterSlow(Index);
+}
+#endif
+
+/// Return the sum of all threads' counters for the given counter index.
+uint64_t sumStatisticCounters(unsigned Index);
+
+/// Zero all threads' counters for the given counter index.
+void resetStatisticCounters(unsigned Index);
+} // end namespace detail
+
 class TrackingStatistic {
 public:
   const char *const DebugType;
@@ -56,59 +96,71 @@ public:
   std::atomic<uint64_t> Value;
   std::atomic<bool> Initialized;
 
+  /// Index of this statistic in the per-thread counter tables, or 0 if it
+  /// doesn't have one. Increments and decrements only update the counter of
+  /// the current thread, so that threads bumping the same hot statistic don't
+  /// contend on Value. The counters are added to Value when the statistic is
+  /// read. The counters of a thread that exits are reused by later threads.
+  std::atomic<unsigned> CounterIndex;
+
   constexpr TrackingStatistic(const char *DebugType, const char *Name,
                               const char *Desc)
       : DebugType(DebugType), Name(Name), Desc(Desc), Value(0),
-        Initialized(false) {}
+        Initialized(false), CounterIndex(0) {}
 
   const char *getDebugType() const { return DebugType; }
   const char *getName() const { return Name; }
   const char *getDesc() const { return Desc; }
 
-  uint64_t getValue() const { return Value.load(std::memory_order_relaxed); }
+  uint64_t getValue() const {
+    uint64_t V = Value.load(std::memory_order_relaxed);
+    if (unsigned Index = CounterIndex.load(std::memory_order_acquire))
+      V += detail::sumStatisticCounters(Index);
+    return V;
+  }
 
   // Allow use of this class as the value itself.
   operator uint64_t() const { return getValue(); }
 
   const TrackingStatistic &operator=(uint64_t Val) {
+    init();
+    if (unsigned Index = CounterIndex.load(std::memory_order_relaxed))
+      detail::resetStatisticCounters(Index);
     Value.store(Val, std::memory_order_relaxed);
-    return init();
+    return *this;
   }
 
   const TrackingStatistic &operator++() {
-    Value.fetch_add(1, std::memory_order_relaxed);
-    return init();
+    add(1);
+    return *this;
   }
 
-  uint64_t operator++(int) {
-    init();
-    return Value.fetch_add(1, std::memory_order_relaxed);
-  }
+  uint64_t operator++(int) { return add(1); }
 
   const TrackingStatistic &operator--() {
-    Value.fetch_sub(1, std::memory_order_relaxed);
-    return init();
+    add(-1);
+    return *this;
   }
 
-  uint64_t operator--(int) {
-    init();
-    return Value.fetch_sub(1, std::memory_order_relaxed);
-  }
+  uint64_t operator--(int) { return add(-1); }
 
   const TrackingStatistic &operator+=(uint64_t V) {
     if (V == 0)
       return *this;
-    Value.fetch_add(V, std::memory_order_relaxed);
-    return init();
+    add(V);
+    return *this;
   }
 
   const TrackingStatistic &operator-=(uint64_t V) {
     if (V == 0)
       return *this;
-    Value.fetch_sub(V, std::memory_order_relaxed);
-    return init();
+    add(-V);
+    return *this;
   }
 
+  /// Raise the statistic to at least \p V. This operates on Value directly, so
+  /// a statistic should either be maintained with updateMax() or be counted,
+  /// but not both.
   void updateMax(uint64_t V) {
     uint64_t PrevMax = Value.load(std::memory_order_relaxed);
     // Keep trying to update max until we succeed or another thread produces
@@ -126,6 +178,20 @@ protected:
     return *this;
   }
 
+  /// Add \p V (modulo 2^64) to the counter of the current thread. Returns the
+  /// previous value as seen by this thread, which doesn't include updates from
+  /// other running threads.
+  uint64_t add(uint64_t V) {
+    init();
+    unsigned Index = CounterIndex.load(std::memory_order_relaxed);
+    if (!Index)
+      return Value.fetch_add(V, std::memory_order_relaxed);
+    // The counter is only contended by resets, which must not be lost.
+    uint64_t Prev = detail::getThreadStatisticCounter(Index).fetch_add(
+        V, std::memory_order_relaxed);
+    return Value.load(std::memory_order_relaxed) + Prev;
+  }
+
   void RegisterStatistic();
 };
 
@@ -0,0 +1,570 @@
+//===- llvm/ADT/SwissMap.h - Hash table with grouped probing ----*- C++ -*-===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// This file defines the SwissMap class, an open addressing hash map with the
+/// same interface as DenseMap that probes many buckets at once.
+///
+/// Besides the buckets, the table keeps one control byte per bucket, holding
+/// 7 bits of the hash of a full bucket or marking the bucket as empty or
+/// deleted. A lookup loads the control bytes of a group of 16 consecutive
+/// buckets and compares all of them with the hash of the key using SSE2 or
+/// NEON instructions where available, so that keys are only compared for the
+/// (usually single) bucket whose control byte matches. Unlike DenseMap, keys
+/// need no empty or tombstone values, and the table can be filled up to 7/8.
+///
+//===----------------------------------------------------------------------===//
+
+#ifndef LLVM_ADT_SWISSMAP_H
+#define LLVM_ADT_SWISSMAP_H
+
+#include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/bit.h"
+#include "llvm/Support/MathExtras.h"
+#include "llvm/Support/MemAlloc.h"
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__) && !defined(__AARCH64EB__)
+#include <arm_neon.h>
+#define LLVM_SWISSMAP_NEON
+#endif
+
+namespace llvm {
+
+namespace detail {
+
+/// Control byte values of empty and deleted buckets. Control bytes of full
+/// buckets are in [0, 127].
+enum : int8_t { SwissMapEmpty = -128, SwissMapDeleted = -2 };
+
+/// The control bytes of a group of consecutive buckets. The match functions
+/// return a mask with one bit set per matching bucket; use index() to get the
+/// position of the lowest one in the group and clear it with Mask &= Mask - 1.
+class SwissMapGroup {
+public:
+  static constexpr unsigned Size = 16;
+
+#if defined(__SSE2__)
+  explicit SwissMapGroup(const int8_t *P)
+      : Ctrl(_mm_loadu_si128(reinterpret_cast<const __m128i *>(P))) {}
+
+  uint64_t match(int8_t C) const {
+    return _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(C), Ctrl));
+  }
+  /// Empty and deleted buckets are the ones with the high bit set.
+  uint64_t matchFree() const { return _mm_movemask_epi8(Ctrl); }
+  static unsigned index(uint64_t Mask) { return llvm::countr_zero(Mask); }
+
+private:
+  __m128i Ctrl;
+#elif defined(LLVM_SWISSMAP_NEON)
+  explicit SwissMapGroup(const int8_t *P) : Ctrl(vld1q_s8(P)) {}
+
+  // NEON has no movemask. Narrowing each 16-bit lane by 4 bits leaves 4 bits
+  // per byte; only the highest of them is kept.
+  uint64_t match(int8_t C) const {
+    return toMask(vceqq_s8(Ctrl, vdupq_n_s8(C)));
+  }
+  uint64_t matchFree() const { return toMask(vcltzq_s8(Ctrl)); }
+  static unsigned index(uint64_t Mask) {
+    return llvm::countr_zero(Mask) >> 2;
+  }
+
+private:
+  static uint64_t toMask(uint8x16_t Cmp) {
+    uint8x8_t Narrowed = vshrn_n_u16(vreinterpretq_u16_u8(Cmp), 4);
+    return vget_lane_u64(vreinterpret_u64_u8(Narrowed), 0) &
+           0x8888888888888888ULL;
+  }
+
+  int8x16_t Ctrl;
+#else
+  explicit SwissMapGroup(const int8_t *P) { std::memcpy(Ctrl, P, Size); }
+
+  uint64_t match(int8_t C) const {
+    uint64_t Mask = 0;
+    for (unsigned I = 0; I != Size; ++I)
+      Mask |= uint64_t(Ctrl[I] == C) << I;
+    return Mask;
+  }
+  uint64_t matchFree() const {
+    uint64_t Mask = 0;
+    for (unsigned I = 0; I != Size; ++I)
+      Mask |= uint64_t(Ctrl[I] < 0) << I;
+    return Mask;
+  }
+  static unsigned index(uint64_t Mask) { return llvm::countr_zero(Mask); }
+
+private:
+  int8_t Ctrl[Size];
+#endif
+
+public:
+  uint64_t matchEmpty() const { return match(SwissMapEmpty); }
+};
+
+} // end namespace detail
+
+template <typename KeyT, typename ValueT,
+          typename KeyInfoT = DenseMapInfo<KeyT>>
+class SwissMap {
+  using Group = detail::SwissMapGroup;
+
+public:
+  using size_type = unsigned;
+  using key_type = KeyT;
+  using mapped_type = ValueT;
+  using value_type = detail::DenseMapPair<KeyT, ValueT>;
+
+private:
+  using BucketT = value_type;
+
+public:
+
+  template <bool IsConst> class IteratorImpl {
+    friend class SwissMap;
+    template <bool> friend class IteratorImpl;
+
+    using BucketPtr =
+        std::conditional_t<IsConst, const BucketT *, BucketT *>;
+
+    const int8_t *Ctrl = nullptr;
+    BucketPtr Ptr = nullptr;
+    BucketPtr End = nullptr;
+
+    IteratorImpl(const int8_t *Ctrl, BucketPtr Ptr, BucketPtr End)
+        : Ctrl(Ctrl), Ptr(Ptr), End(End) {}
+
+    void skipFree() {
+      while (Ptr != End && *Ctrl < 0) {
+        ++Ctrl;
+        ++Ptr;
+      }
+    }
+
+  public:
+    using difference_type = std::ptrdiff_t;
+    using value_type = std::conditional_t<IsConst, const BucketT, BucketT>;
+    using pointer = value_type *;
+    using reference = value_type &;
+    using iterator_category = std::forward_iterator_tag;
+
+    IteratorImpl() = default;
+
+    // Allow conversion from iterator to const_iterator.
+    template <bool IsConstSrc,
+              typename = std::enable_if_t<!IsConstSrc && IsConst>>
+    IteratorImpl(const IteratorImpl<IsConstSrc> &I)
+        : Ctrl(I.Ctrl), Ptr(I.Ptr), End(I.End) {}
+
+    reference operator*() const { return *Ptr; }
+    pointer operator->() const { return Ptr; }
+
+    friend bool operator==(const IteratorImpl &LHS, const IteratorImpl &RHS) {
+      return LHS.Ptr == RHS.Ptr;
+    }
+    friend bool operator!=(const IteratorImpl &LHS, const IteratorImpl &RHS) {
+      return LHS.Ptr != RHS.Ptr;
+    }
+
+    IteratorImpl &operator++() {
+      ++Ctrl;
+      ++Ptr;
+      skipFree();
+      return *this;
+    }
+    IteratorImpl operator++(int) {
+      IteratorImpl Tmp = *this;
+      ++*this;
+      return Tmp;
+    }
+  };
+
+  using iterator = IteratorImpl<false>;
+  using const_iterator = IteratorImpl<true>;
+
+  explicit SwissMap(unsigned InitialReserve = 0) { reserve(InitialReserve); }
+
+  SwissMap(std::initializer_list<value_type> Vals) {
+    reserve(Vals.size());
+    insert(Vals.begin(), Vals.end());
+  }
+
+  template <typename InputIt> SwissMap(const InputIt &I, const InputIt &E) {
+    insert(I, E);
+  }
+
+  SwissMap(const SwissMap &Other) { copyFrom(Other); }
+
+  SwissMap(SwissMap &&Other) { swap(Other); }
+
+  SwissMap &operator=(const SwissMap &Other) {
+    if (&Other != this) {
+      destroyAll();
+      deallocate();
+      copyFrom(Other);
+    }
+    return *this;
+  }
+
+  SwissMap &operator=(SwissMap &&Other) {
+    destroyAll();
+    deallocate();
+    swap(Other);
+    return *this;
+  }
+
+  ~SwissMap() {
+    destroyAll();
+    deallocate();
+  }
+
+  void swap(SwissMap &RHS) {
+    std::swap(Ctrl, RHS.Ctrl);
+    std::swap(Buckets, RHS.Buckets);
+    std::swap(NumBuckets, RHS.NumBuckets);
+    std::swap(NumEntries, RHS.NumEntries);
+    std::swap(GrowthLeft, RHS.GrowthLeft);
+  }
+
+  iterator begin() { return makeBeginIterator<false>(); }
+  iterator end() { return iterator(nullptr, Buckets + NumBuckets, nullptr); }
+  const_iterator begin() const { return makeBeginIterator<true>(); }
+  const_iterator end() const {
+    return const_iterator(nullptr, Buckets + NumBuckets, nullptr);
+  }
+
+  [[nodiscard]] bool empty() const { return NumEntries == 0; }
+  unsigned size() const { return NumEntries; }
+
+  /// Grow the map so that it can accommodate \p NumItems items without having
+  /// to rehash.
+  void reserve(size_type NumItems) {
+    if (NumItems == 0)
+      return;
+    unsigned NewNumBuckets = Group::Size;
+    while (getCapacity(NewNumBuckets) < NumItems)
+      NewNumBuckets *= 2;
+    if (NewNumBuckets > NumBuckets)
+      rehash(NewNumBuckets);
+  }
+
+  void clear() {
+    if (NumEntries == 0)
+      return;
+    destroyAll();
+    std::memset(Ctrl, detail::SwissMapEmpty, NumBuckets + Group::Size);
+    NumEntries = 0;
+    GrowthLeft = getCapacity(NumBuckets);
+  }
+
+  /// Return true if the specified key is in the map, false otherwise.
+  bool contains(const KeyT &Key) const { return findBucket(Key, hash(Key)); }
+
+  /// Return 1 if the specified key is in the map, 0 otherwise.
+  size_type count(const KeyT &Key) const { return contains(Key) ? 1 : 0; }
+
+  iterator find(const KeyT &Key) {
+    if (value_type *Bucket = findBucket(Key, hash(Key)))
+      return makeIterator<false>(Bucket);
+    return end();
+  }
+  const_iterator find(const KeyT &Key) const {
+    if (value_type *Bucket = findBucket(Key, hash(Key)))
+      return makeIterator<true>(Bucket);
+    return end();
+  }
+
+  /// Return the entry for the specified key, or a default constructed value
+  /// if no such entry exists.
+  ValueT lookup(const KeyT &Key) const {
+    if (value_type *Bucket = findBucket(Key, hash(Key)))
+      return Bucket->getSecond();
+    return ValueT();
+  }
+
+  /// Return the entry for the specified key. The key must be in the map.
+  const ValueT &at(const KeyT &Key) const {
+    value_type *Bucket = findBucket(Key, hash(Key));
+    assert(Bucket && "SwissMap::at failed due to a missing key");
+    return Bucket->getSecond();
+  }
+
+  std::pair<iterator, bool> insert(const std::pair<KeyT, ValueT> &KV) {
+    return try_emplace(KV.first, KV.second);
+  }
+  std::pair<iterator, bool> insert(std::pair<KeyT, ValueT> &&KV) {
+    return try_emplace(std::move(KV.first), std::move(KV.second));
+  }
+
+  /// Insert a range of items.
+  template <typename InputIt> void insert(InputIt I, InputIt E) {
+    for (; I != E; ++I)
+      insert(*I);
+  }
+
+  /// Inserts key,value pair into the map if the key isn't already in the map.
+  /// The value is constructed in-place if the key is not in the map, otherwise
+  /// it is not moved.
+  template <typename... Ts>
+  std::pair<iterator, bool> try_emplace(KeyT &&Key, Ts &&...Args) {
+    return tryEmplaceImpl(std::move(Key), std::forward<Ts>(Args)...);
+  }
+  template <typename... Ts>
+  std::pair<iterator, bool> try_emplace(const KeyT &Key, Ts &&...Args) {
+    return tryEmplaceImpl(Key, std::forward<Ts>(Args)...);
+  }
+
+  template <typename V>
+  std::pair<iterator, bool> insert_or_assign(const KeyT &Key, V &&Val) {
+    auto Ret = try_emplace(Key, std::forward<V>(Val));
+    if (!Ret.second)
+      Ret.first->second = std::forward<V>(Val);
+    return Ret;
+  }
+  template <typename V>
+  std::pair<iterator, bool> insert_or_assign(KeyT &&Key, V &&Val) {
+    auto Ret = try_emplace(std::move(Key), std::forward<V>(Val));
+    if (!Ret.second)
+      Ret.first->second = std::forward<V>(Val);
+    return Ret;
+  }
+
+  bool erase(const KeyT &Key) {
+    value_type *Bucket = findBucket(Key, hash(Key));
+    if (!Bucket)
+      return false;
+    eraseBucket(Bucket);
+    return true;
+  }
+  void erase(iterator I) { eraseBucket(I.Ptr); }
+
+  ValueT &operator[](const KeyT &Key) { return try_emplace(Key).first->second; }
+  ValueT &operator[](KeyT &&Key) {
+    return try_emplace(std::move(Key)).first->second;
+  }
+
+  /// Return the approximate size (in bytes) of the actual map.
+  size_t getMemorySize() const {
+    return NumBuckets ? NumBuckets * sizeof(value_type) + NumBuckets +
+                            Group::Size
+                      : 0;
+  }
+
+private:
+  /// The maximum number of full and deleted buckets, which leaves at least one
+  /// empty bucket for lookups to stop at.
+  static unsigned getCapacity(unsigned NumBuckets) {
+    return NumBuckets - NumBuckets / 8;
+  }
+
+  static uint64_t hash(const KeyT &Key) {
+    // DenseMapInfo hashes are not necessarily well distributed in either the
+    // low or the high bits, so mix them before splitting the hash.
+    uint64_t H = uint64_t(KeyInfoT::getHashValue(Key)) * 0x9E3779B97F4A7C15ULL;
+    return H ^ (H >> 32);
+  }
+  /// The part of the hash stored in the control byte.
+  static int8_t getH2(uint64_t Hash) { return Hash & 0x7f; }
+  /// The part of the hash that selects the first group to probe.
+  static uint64_t getH1(uint64_t Hash) { return Hash >> 7; }
+
+  template <bool IsConst>
+  IteratorImpl<IsConst> makeIterator(value_type *B) const {
+    return IteratorImpl<IsConst>(Ctrl + (B - Buckets), B,
+                                 Buckets + NumBuckets);
+  }
+  template <bool IsConst> IteratorImpl<IsConst> makeBeginIterator() const {
+    IteratorImpl<IsConst> I(Ctrl, Buckets, Buckets + NumBuckets);
+    I.skipFree();
+    return I;
+  }
+
+  /// Probe groups of buckets, starting at the one selected by \p Hash and
+  /// using triangular steps, which visits every group of a power of two sized
+  /// table. \p Fn returns true to stop probing.
+  template <typename FnT> void probe(uint64_t Hash, FnT Fn) const {
+    unsigned Mask = NumBuckets - 1;
+    unsigned Pos = getH1(Hash) & Mask;
+    for (unsigned Step = Group::Size;; Step += Group::Size) {
+      if (Fn(Pos, Group(Ctrl + Pos)))
+        return;
+      Pos = (Pos + Step) & Mask;
+    }
+  }
+
+  value_type *findBucket(const KeyT &Key, uint64_t Hash) const {
+    if (NumBuckets == 0)
+      return nullptr;
+    value_type *Found = nullptr;
+    probe(Hash, [&](unsigned Pos, const Group &G) {
+      for (uint64_t M = G.match(getH2(Hash)); M; M &= M - 1) {
+        unsigned I = (Pos + Group::index(M)) & (NumBuckets - 1);
+        if (KeyInfoT::isEqual(Key, Buckets[I].getFirst())) {
+          Found = Buckets + I;
+          return true;
+        }
+      }
+      return G.matchEmpty() != 0;
+    });
+    return Found;
+  }
+
+  unsigned findFreeBucket(uint64_t Hash) const {
+    unsigned Found = 0;
+    probe(Hash, [&](unsigned Pos, const Group &G) {
+      uint64_t M = G.matchFree();
+      if (!M)
+        return false;
+      Found = (Pos + Group::index(M)) & (NumBuckets - 1);
+      return true;
+    });
+    return Found;
+  }
+
+  /// Set a control byte. The control bytes of the first group are repeated
+  /// after the last bucket so that groups can be loaded at any position.
+  void setCtrl(unsigned I, int8_t C) {
+    Ctrl[I] = C;
+    if (I < Group::Size)
+      Ctrl[NumBuckets + I] = C;
+  }
+
+  template <typename KeyArgT, typename... Ts>
+  std::pair<iterator, bool> tryEmplaceImpl(KeyArgT &&Key, Ts &&...Args) {
+    uint64_t Hash = hash(Key);
+    if (value_type *Bucket = findBucket(Key, Hash))
+      return {makeIterator<false>(Bucket), false};
+
+    if (GrowthLeft == 0) {
+      // Rehash in place if at least half of the used buckets are deleted.
+      if (NumBuckets == 0 || NumEntries * 2 > getCapacity(NumBuckets))
+        rehash(NumBuckets ? NumBuckets * 2 : Group::Size);
+      else
+        rehash(NumBuckets);
+    }
+    unsigned I = findFreeBucket(Hash);
+    if (Ctrl[I] == detail::SwissMapEmpty)
+      --GrowthLeft;
+    setCtrl(I, getH2(Hash));
+    ++NumEntries;
+
+    value_type *Bucket = Buckets + I;
+    ::new (&Bucket->getFirst()) KeyT(std::forward<KeyArgT>(Key));
+    ::new (&Bucket->getSecond()) ValueT(std::forward<Ts>(Args)...);
+    return {makeIterator<false>(Bucket), true};
+  }
+
+  void eraseBucket(value_type *Bucket) {
+    Bucket->getSecond().~ValueT();
+    Bucket->getFirst().~KeyT();
+    setCtrl(Bucket - Buckets, detail::SwissMapDeleted);
+    --NumEntries;
+  }
+
+  void allocate(unsigned Num) {
+    NumBuckets = Num;
+    Ctrl = static_cast<int8_t *>(allocate_buffer(Num + Group::Size, 1));
+    std::memset(Ctrl, detail::SwissMapEmpty, Num + Group::Size);
+    Buckets = static_cast<value_type *>(
+        allocate_buffer(sizeof(value_type) * Num, alignof(value_type)));
+    NumEntries = 0;
+    GrowthLeft = getCapacity(Num);
+  }
+
+  void deallocate() {
+    if (NumBuckets == 0)
+      return;
+    deallocate_buffer(Ctrl, NumBuckets + Group::Size, 1);
+    deallocate_buffer(Buckets, sizeof(value_type) * NumBuckets,
+                      alignof(value_type));
+    Ctrl = nullptr;
+    Buckets = nullptr;
+    NumBuckets = 0;
+    NumEntries = 0;
+    GrowthLeft = 0;
+  }
+
+  void destroyAll() {
+    for (unsigned I = 0; I != NumBuckets; ++I) {
+      if (Ctrl[I] < 0)
+        continue;
+      Buckets[I].getSecond().~ValueT();
+      Buckets[I].getFirst().~KeyT();
+    }
+  }
+
+  void rehash(unsigned NewNumBuckets) {
+    int8_t *OldCtrl = Ctrl;
+    value_type *OldBuckets = Buckets;
+    unsigned OldNumBuckets = NumBuckets;
+    unsigned OldNumEntries = NumEntries;
+    allocate(NewNumBuckets);
+
+    for (unsigned I = 0; I != OldNumBuckets; ++I) {
+      if (OldCtrl[I] < 0)
+        continue;
+      value_type &Old = OldBuckets[I];
+      uint64_t Hash = hash(Old.getFirst());
+      unsigned J = findFreeBucket(Hash);
+      setCtrl(J, getH2(Hash));
+      ::new (&Buckets[J].getFirst()) KeyT(std::move(Old.getFirst()));
+      ::new (&Buckets[J].getSecond()) ValueT(std::move(Old.getSecond()));
+      Old.getSecond().~ValueT();
+      Old.getFirst().~KeyT();
+    }
+    NumEntries = OldNumEntries;
+    GrowthLeft -= OldNumEntries;
+
+    if (OldNumBuckets) {
+      deallocate_buffer(OldCtrl, OldNumBuckets + Group::Size, 1);
+      deallocate_buffer(OldBuckets, sizeof(value_type) * OldNumBuckets,
+                        alignof(value_type));
+    }
+  }
+
+  void copyFrom(const SwissMap &Other) {
+    if (Other.NumBuckets == 0)
+      return;
+    allocate(Other.NumBuckets);
+    std::memcpy(Ctrl, Other.Ctrl, NumBuckets + Group::Size);
+    for (unsigned I = 0; I != NumBuckets; ++I) {
+      if (Ctrl[I] < 0)
+        continue;
+      ::new (&Buckets[I].getFirst()) KeyT(Other.Buckets[I].getFirst());
+      ::new (&Buckets[I].getSecond()) ValueT(Other.Buckets[I].getSecond());
+    }
+    NumEntries = Other.NumEntries;
+    GrowthLeft = Other.GrowthLeft;
+  }
+
+  int8_t *Ctrl = nullptr;
+  value_type *Buckets = nullptr;
+  unsigned NumBuckets = 0;
+  unsigned NumEntries = 0;
+  unsigned GrowthLeft = 0;
+};
+
+template <typename KeyT, typename ValueT, typename KeyInfoT>
+inline void swap(SwissMap<KeyT, ValueT, KeyInfoT> &LHS,
+                 SwissMap<KeyT, ValueT, KeyInfoT> &RHS) {
+  LHS.swap(RHS);
+}
+
+} // end namespace llvm
+
+#endif // LLVM_ADT_SWISSMAP_H
@@ -260,6 +260,13 @@ public:
 
   CaptureInfo *CI;
 
+  /// Underlying objects of pointers seen by the queries so far, as computed by
+  /// BasicAA. Only set in batch mode, where the IR does not change between
+  /// queries, so that a batch of queries against the same location strips its
+  /// GEPs and casts only once.
+  using UnderlyingObjectCacheT = SmallDenseMap<const Value *, const Value *, 8>;
+  UnderlyingObjectCacheT *UnderlyingObjects = nullptr;
+
   /// Query depth used to distinguish recursive queries.
   unsigned Depth = 0;
 
@@ -624,10 +631,15 @@ class BatchAAResults {
   AAResults &AA;
   AAQueryInfo AAQI;
   SimpleCaptureInfo SimpleCI;
+  AAQueryInfo::UnderlyingObjectCacheT UnderlyingObjects;
 
 public:
-  BatchAAResults(AAResults &AAR) : AA(AAR), AAQI(AAR, &SimpleCI) {}
-  BatchAAResults(AAResults &AAR, CaptureInfo *CI) : AA(AAR), AAQI(AAR, CI) {}
+  BatchAAResults(AAResults &AAR) : AA(AAR), AAQI(AAR, &SimpleCI) {
+    AAQI.UnderlyingObjects = &UnderlyingObjects;
+  }
+  BatchAAResults(AAResults &AAR, CaptureInfo *CI) : AA(AAR), AAQI(AAR, CI) {
+    AAQI.UnderlyingObjects = &UnderlyingObjects;
+  }
 
   AliasResult alias(const MemoryLocation &LocA, const MemoryLocation &LocB) {
     return AA.alias(LocA, LocB, AAQI);
@@ -1008,6 +1008,12 @@ private:
 /// disambiguate memory accesses, or they may want the nearest dominating
 /// may-aliasing MemoryDef for a call or a store. This API enables a
 /// standardized interface to getting and using that info.
+///
+/// The caching walker stores the clobber it finds for an access on the access
+/// itself (see MemoryUseOrDef::setOptimized), so results persist for as long
+/// as MemorySSA is preserved, including across passes. MemorySSAUpdater only
+/// resets the accesses an update can affect. Queries for an explicit
+/// MemoryLocation are not cached.
 class MemorySSAWalker {
 public:
   MemorySSAWalker(MemorySSA *);
@@ -32,6 +32,11 @@ class raw_pwrite_stream;
 ///
 /// Writes bitcode for individual partitions into output streams in BCOSs, if
 /// BCOSs is not empty.
+///
+/// Parallelism comes only from splitting the module. Machine passes for the
+/// functions of one module cannot run concurrently: they share the
+/// TargetMachine's subtarget caches, the MachineModuleInfo and a single
+/// MCContext, and AsmPrinter emits into one streamer in function order.
 void splitCodeGen(
     Module &M, ArrayRef<raw_pwrite_stream *> OSs,
     ArrayRef<llvm::raw_pwrite_stream *> BCOSs,
@@ -183,6 +183,11 @@ namespace llvm {
     /// case of a huge region that gets reduced).
     SUnit *BarrierChain = nullptr;
 
+    /// Identified underlying IR objects of the memory operand values seen so
+    /// far, or an empty list if there are none. The IR does not change while
+    /// a function is scheduled, so lookups are shared by all its regions.
+    DenseMap<const Value *, SmallVector<Value *, 4>> UnderlyingObjectsCache;
+
   public:
     /// A list of SUnits, used in Value2SUsMap, during DAG construction.
     /// Note: to gain speed it might be worth investigating an optimized
@@ -55,6 +55,14 @@ class OutputAggregator;
 ///
 /// Once the object has been finalized, it can be saved to a file or section.
 ///
+/// All FunctionInfo objects, including their line tables and inline trees,
+/// are kept in memory until finalize(...) has sorted and uniqued them, so peak
+/// memory scales with the total amount of function information rather than
+/// with the size of the largest compile unit. Passing a segment size to
+/// save(...) limits the size of each output file, but not the memory used to
+/// create them; very large inputs may need to be split by address range and
+/// converted in separate runs.
+///
 /// ENCODING
 ///
 /// GSYM files are designed to be memory mapped into a process as shared, read
@@ -47,6 +47,11 @@ using FileLineInfoKind = DILineInfoSpecifier::FileLineInfoKind;
 
 class CachedBinary;
 
+/// Symbolizes addresses in binaries, keeping the parsed binaries and their
+/// debug info in an LRU cache bounded by Options::MaxCacheSize. A single
+/// instance is meant to be reused across many requests, as llvm-symbolizer
+/// does when it reads addresses from standard input, so that each binary is
+/// only opened and indexed once. The class is not thread-safe.
 class LLVMSymbolizer {
 public:
   struct Options {
@@ -85,6 +85,15 @@ std::string getDebuginfodDebuginfoUrlPath(object::BuildIDRef ID);
 /// server URLs.
 Expected<std::string> getCachedOrDownloadDebuginfo(object::BuildIDRef ID);
 
+class ThreadPoolInterface;
+
+/// Fetches the debug binaries for all of \p IDs into the default local cache,
+/// running the downloads concurrently on \p Pool, and waits for them to
+/// finish. Failures are ignored; they are reported again by
+/// getCachedOrDownloadDebuginfo when the artifact is actually requested.
+void prefetchDebuginfo(ArrayRef<object::BuildID> IDs,
+                       ThreadPoolInterface &Pool);
+
 /// Fetches any debuginfod artifact using the default local cache directory and
 /// server URLs.
 Expected<std::string> getCachedOrDownloadArtifact(StringRef UniqueKey,
@@ -97,8 +106,6 @@ Expected<std::string> getCachedOrDownloadArtifact(
     StringRef UniqueKey, StringRef UrlPath, StringRef CacheDirectoryPath,
     ArrayRef<StringRef> DebuginfodUrls, std::chrono::milliseconds Timeout);
 
-class ThreadPoolInterface;
-
 struct DebuginfodLogEntry {
   std::string Message;
   DebuginfodLogEntry() = default;
@@ -74,6 +74,13 @@ bool nonMicrosoftDemangle(std::string_view MangledName, std::string &Result,
 /// "Partial" demangler. This supports demangling a string into an AST
 /// (typically an intermediate stage in itaniumDemangle) and querying certain
 /// properties or partially printing the demangled name.
+///
+/// When demangling many symbols, reuse one ItaniumPartialDemangler and one
+/// output buffer rather than calling itaniumDemangle for each name. Each call
+/// to partialDemangle resets the parser in place, so the allocator's inline
+/// block is reused and most names need no heap allocation besides growing the
+/// output buffer. Substitutions are only valid within a single mangled name,
+/// so nothing is cached from one call to the next.
 struct ItaniumPartialDemangler {
   ItaniumPartialDemangler();
 
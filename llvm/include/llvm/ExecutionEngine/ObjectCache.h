@@ -20,6 +20,13 @@ class Module;
 /// This is the base ObjectCache type which can be provided to an
 /// ExecutionEngine for the purpose of avoiding compilation for Modules that
 /// have already been compiled and an object file is available.
+///
+/// With ORC, a cache is passed to orc::SimpleCompiler, which consults it
+/// before and notifies it after compiling each module. The cache decides what
+/// identifies a module: keying by the module identifier, as lli's cache does,
+/// is only safe if identifiers are unique per content. A cache shared between
+/// processes of different builds should instead key by a hash of the module
+/// and of the target options that affect code generation.
 class ObjectCache {
   virtual void anchor();
 
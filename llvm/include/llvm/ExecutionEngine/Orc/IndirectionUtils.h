@@ -303,6 +303,12 @@ public:
   virtual ExecutorSymbolDef findPointer(StringRef Name) = 0;
 
   /// Change the value of the implementation pointer for the stub.
+  ///
+  /// Callers go through the stub on every call, so this can also retarget a
+  /// function that has already been compiled, e.g. to a version recompiled at
+  /// a higher optimization level. The local implementation stores the new
+  /// address atomically, so concurrent callers see either the old or the new
+  /// implementation. The old code must stay alive for calls already in it.
   virtual Error updatePointer(StringRef Name, ExecutorAddr NewAddr) = 0;
 
 private:
@@ -72,14 +72,17 @@ private:
 
   void launchCompile(ExecutorAddr FAddr) {
     SymbolNameSet CandidateSet;
-    // Copy CandidateSet is necessary, to avoid unsynchronized access to
-    // the datastructure.
+    // Take the CandidateSet out of the map, to avoid unsynchronized access to
+    // the datastructure. The function entry calls into here every time it
+    // runs, but the likely callees only need to be looked up once: later
+    // lookups would find them already compiled or being compiled.
     {
       std::lock_guard<std::mutex> Lockit(ConcurrentAccess);
       auto It = GlobalSpecMap.find(FAddr);
       if (It == GlobalSpecMap.end())
         return;
-      CandidateSet = It->getSecond();
+      CandidateSet = std::move(It->getSecond());
+      GlobalSpecMap.erase(It);
     }
 
     SymbolDependenceMap SpeculativeLookUpImpls;
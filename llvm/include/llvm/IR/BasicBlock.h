@@ -66,10 +66,12 @@ public:
 
 private:
   friend class BlockAddress;
+  friend class Function;
   friend class SymbolTableListTraits<BasicBlock>;
 
   InstListType InstList;
   Function *Parent;
+  unsigned Number = -1u;
 
 public:
   /// Attach a DbgMarker to the given instruction. Enables the storage of any
@@ -206,6 +208,16 @@ public:
   const Function *getParent() const { return Parent; }
         Function *getParent()       { return Parent; }
 
+  /// Return a number identifying this block within its parent function, for
+  /// indexing side tables. Numbers are assigned when a block is inserted into
+  /// a function, are unique in that function and below
+  /// Function::getMaxBlockNumber(). Removing blocks leaves gaps until the next
+  /// Function::renumberBlocks().
+  unsigned getNumber() const {
+    assert(Parent && "only blocks in a function have a number");
+    return Number;
+  }
+
   /// Return the module owning the function this basic block belongs to, or
   /// nullptr if the function does not have a module.
   ///
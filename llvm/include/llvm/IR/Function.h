@@ -78,6 +78,8 @@ private:
   std::unique_ptr<ValueSymbolTable>
       SymTab;                             ///< Symbol table of args/instructions
   AttributeList AttributeSets;            ///< Parameter attributes
+  unsigned NextBlockNum = 0;              ///< Next number for a new block
+  unsigned BlockNumEpoch = 0;             ///< Incremented by renumberBlocks
 
   /*
    * Value::SubclassData
@@ -98,6 +100,7 @@ private:
   };
 
   friend class SymbolTableListTraits<Function>;
+  friend class BasicBlock;
 
 public:
   /// Is this function using intrinsics to record the position of debugging
@@ -808,6 +811,20 @@ public:
   const BasicBlock        &back() const { return BasicBlocks.back();  }
         BasicBlock        &back()       { return BasicBlocks.back();  }
 
+  /// Return a value larger than the number of any block in this function.
+  /// Intended for sizing side tables indexed by BasicBlock::getNumber().
+  unsigned getMaxBlockNumber() const { return NextBlockNum; }
+
+  /// Renumber the blocks of this function densely, in layout order, starting
+  /// from 0. Side tables indexed by block number become stale; they can
+  /// detect this by comparing getBlockNumberEpoch() against the value they
+  /// were built with.
+  void renumberBlocks();
+
+  /// Return the number of times the blocks have been renumbered. Block
+  /// numbers are stable as long as this doesn't change.
+  unsigned getBlockNumberEpoch() const { return BlockNumEpoch; }
+
 /// @name Function Argument Iteration
 /// @{
 
@@ -31,6 +31,10 @@ class RemarkStreamer;
 
 /// Streamer for LLVM remarks which has logic for dealing with DiagnosticInfo
 /// objects.
+///
+/// The pass filter is applied in emit(), after the pass has already built the
+/// remark and its arguments. A filter therefore makes the output smaller, but
+/// does not make building filtered-out remarks any cheaper.
 class LLVMRemarkStreamer {
   remarks::RemarkStreamer &RS;
   /// Convert diagnostics into remark objects.
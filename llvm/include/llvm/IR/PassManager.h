@@ -888,6 +888,14 @@ using ModuleAnalysisManagerFunctionProxy =
 /// Note that although function passes can access module analyses, module
 /// analyses are not invalidated while the function passes are running, so they
 /// may be stale.  Function analyses will not be stale.
+///
+/// Functions are currently visited one at a time, in module order. Running
+/// them concurrently would additionally require the LLVMContext uniquing
+/// tables (constants, types, metadata) and the use lists of globals to be
+/// safe to mutate from several threads, and a function analysis manager per
+/// thread; none of that is the case today. Parallelism over a module is
+/// instead obtained by splitting it into partitions in separate contexts (see
+/// SplitModule), as done for LTO code generation.
 class ModuleToFunctionPassAdaptor
     : public PassInfoMixin<ModuleToFunctionPassAdaptor> {
 public:
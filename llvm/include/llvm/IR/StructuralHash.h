@@ -24,6 +24,13 @@ class Module;
 using IRHash = uint64_t;
 
 /// Returns a hash of the function \p F.
+///
+/// The hash is intended to detect modifications, not to identify functions:
+/// it ignores value names and most operands, and it does not cover anything
+/// outside the function body (callee attributes, global initializers, the
+/// data layout) that transformations depend on. Two functions with the same
+/// hash may therefore optimize differently, so it is not suitable as the key
+/// of a cache of optimized IR.
 /// \param F The function to hash.
 /// \param DetailedHash Whether or not to encode additional information in the
 /// hash. The additional information added into the hash when this flag is set
@@ -40,6 +40,12 @@ class Value;
 /// all of the uses for a particular value definition. It also supports jumping
 /// directly to the used value when we arrive from the User's operands, and
 /// jumping directly to the User when we arrive from the Value's uses.
+///
+/// Each Use is four pointers. The doubly linked use list is what makes
+/// set(), replaceAllUsesWith() and operand removal O(1), and many passes
+/// depend on that while they walk and mutate use lists. A more compact
+/// encoding would have to rebuild the lists on demand, and would give those
+/// operations up.
 class Use {
 public:
   Use(const Use &U) = delete;
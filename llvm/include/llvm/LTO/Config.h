@@ -171,6 +171,12 @@ struct Config {
   /// Specific thinLTO modules to compile.
   std::vector<std::string> ThinLTOModulesToCompile;
 
+  /// If non-zero, the in-process ThinLTO backend only starts a job when the
+  /// estimated peak memory of all running jobs, including the new one, stays
+  /// within this many bytes. A job is always started if none are running.
+  /// Ignored when LLVM is built without threads.
+  uint64_t ThinLTOMemoryBudget = 0;
+
   /// Time trace enabled.
   bool TimeTraceEnabled = false;
 
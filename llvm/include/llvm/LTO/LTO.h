@@ -63,6 +63,13 @@ void thinLTOInternalizeAndPromoteInIndex(
 /// Computes a unique hash for the Module considering the current list of
 /// export/import and other global analysis results.
 /// The hash is produced in \p Key.
+///
+/// The key covers whole modules: every module that \p ModuleID imports from
+/// contributes its module hash, so any change to such a module invalidates
+/// the entry even if the imported functions are unchanged. Keying on the
+/// imported functions alone would need per-function hashes in the summary,
+/// and caching below module granularity would need the cached code for each
+/// function to be relinked into an object, which the backend cannot do.
 void computeLTOCacheKey(
     SmallString<40> &Key, const lto::Config &Conf,
     const ModuleSummaryIndex &Index, StringRef ModuleID,
@@ -215,6 +222,19 @@ ThinBackend createInProcessThinBackend(ThreadPoolStrategy Parallelism,
                                        bool ShouldEmitIndexFiles = false,
                                        bool ShouldEmitImportsFiles = false);
 
+/// This ThinBackend hands each backend job to an external executor, which may
+/// run it on another machine. For every job the executor is invoked as
+///   <Executor> <ExecutorArgs...> <input bitcode> <summary index> <output>
+/// and must write the native object to <output> and exit with status 0. The
+/// index refers to imported modules by their module identifiers, so those must
+/// be readable by the executor. A job whose executor fails is run in-process.
+/// The remaining parameters have the same meaning as for
+/// createInProcessThinBackend.
+ThinBackend createOutOfProcessThinBackend(
+    ThreadPoolStrategy Parallelism, std::string Executor,
+    std::vector<std::string> ExecutorArgs, IndexWriteCallback OnWrite = nullptr,
+    bool ShouldEmitIndexFiles = false, bool ShouldEmitImportsFiles = false);
+
 /// This ThinBackend writes individual module indexes to files, instead of
 /// running the individual backend jobs. This backend is for distributed builds
 /// where separate processes will invoke the real backends.
@@ -36,7 +36,9 @@ public:
   /// \param CB code buffer
   virtual void emitPrefix(const MCInst &Inst, SmallVectorImpl<char> &CB,
                           const MCSubtargetInfo &STI) const {}
-  /// Encode the given \p Inst to bytes and append to \p CB.
+  /// Encode the given \p Inst to bytes and append to \p CB. \p CB may
+  /// already hold other instructions; the offsets of the fixups appended to
+  /// \p Fixups are relative to the start of \p Inst.
   virtual void encodeInstruction(const MCInst &Inst, SmallVectorImpl<char> &CB,
                                  SmallVectorImpl<MCFixup> &Fixups,
                                  const MCSubtargetInfo &STI) const = 0;
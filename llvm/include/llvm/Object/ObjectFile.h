@@ -386,6 +386,11 @@ public:
   static Expected<std::unique_ptr<ObjectFile>>
   createXCOFFObjectFile(MemoryBufferRef Object, unsigned FileType);
 
+  /// Create an ELF object file. Only the ELF header is validated up front.
+  /// Section headers are read again on each request rather than copied into
+  /// tables. With \p InitContent set, the section header table is also scanned
+  /// once to find the symbol table sections. Tools that never iterate symbols
+  /// can pass false to skip that scan.
   static Expected<std::unique_ptr<ObjectFile>>
   createELFObjectFile(MemoryBufferRef Object, bool InitContent = true);
 
@@ -927,6 +927,12 @@ public:
 ///
 /// This is the main interface to get coverage information, using a profile to
 /// fill out execution counts.
+///
+/// Loading decodes the mapping regions of every function up front, on a single
+/// thread, and keeps all FunctionRecords resident, so memory grows with the
+/// size of the whole program rather than with the files being viewed. The
+/// per-file queries below are const and may be called concurrently once
+/// loading has finished; llvm-cov relies on this for its -j option.
 class CoverageMapping {
   DenseMap<size_t, DenseSet<size_t>> RecordProvenance;
   std::vector<FunctionRecord> Functions;
@@ -1262,6 +1262,16 @@ std::error_code getUniqueID(const Twine Path, UniqueID &Result);
 /// is returned on error.
 ErrorOr<space_info> disk_space(const Twine &Path);
 
+/// Hints about how the pages of a mapped file are going to be accessed. See
+/// mapped_file_region::advise().
+enum class access_hint {
+  normal,     ///< No particular pattern; undo previous hints.
+  sequential, ///< Read ahead aggressively and drop pages once they are used.
+  random,     ///< Don't read ahead.
+  will_need,  ///< Start reading the whole mapping in now.
+  huge_pages  ///< Back the mapping with huge pages where supported.
+};
+
 /// This class represents a memory mapped file. It is based on
 /// boost::iostreams::mapped_file.
 class mapped_file_region {
@@ -1297,6 +1307,7 @@ private:
 
   void unmapImpl();
   void dontNeedImpl();
+  void adviseImpl(access_hint Hint);
 
   std::error_code init(sys::fs::file_t FD, uint64_t Offset, mapmode Mode);
 
@@ -1328,6 +1339,11 @@ public:
   }
   void dontNeed() { dontNeedImpl(); }
 
+  /// Pass an access pattern hint for the whole mapping to the kernel. This
+  /// calls madvise() on *NIX systems. Hints which are not supported on the
+  /// host are ignored.
+  void advise(access_hint Hint) { adviseImpl(Hint); }
+
   size_t size() const;
   char *data() const;
 
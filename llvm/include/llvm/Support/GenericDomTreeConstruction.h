@@ -73,7 +73,13 @@ struct SemiNCAInfo {
   // Number to node mapping is 1-based. Initialize the mapping to start with
   // a dummy element.
   std::vector<NodePtr> NumToNode = {nullptr};
-  DenseMap<NodePtr, InfoRec> NodeToInfo;
+  // Info records are kept in a vector and NodeToInfo maps nodes to indices into
+  // it, rather than holding the records itself. This keeps the map's buckets
+  // small, so lookups touch less memory and growing the map is cheap on large
+  // CFGs. Every record has exactly one entry in NodeToInfo; code that erases
+  // nodes from the map must also drop their records.
+  SmallVector<InfoRec, 0> NodeInfos;
+  DenseMap<NodePtr, unsigned> NodeToInfo;
 
   using UpdateT = typename DomTreeT::UpdateType;
   using UpdateKind = typename DomTreeT::UpdateKind;
@@ -99,6 +105,7 @@ struct SemiNCAInfo {
 
   void clear() {
     NumToNode = {nullptr}; // Restore to initial state with a dummy start node.
+    NodeInfos.clear();
     NodeToInfo.clear();
     // Don't reset the pointer to BatchUpdateInfo here -- if there's an update
     // in progress, we need this information to continue it.
@@ -123,11 +130,25 @@ struct SemiNCAInfo {
     return Res;
   }
 
-  NodePtr getIDom(NodePtr BB) const {
-    auto InfoIt = NodeToInfo.find(BB);
+  // Returns the info record for N, or nullptr if there is none.
+  InfoRec *getNodeInfo(NodePtr N) {
+    auto InfoIt = NodeToInfo.find(N);
     if (InfoIt == NodeToInfo.end()) return nullptr;
+    return &NodeInfos[InfoIt->second];
+  }
+
+  // Returns the info record for N, creating an empty one if needed. This may
+  // invalidate references to other records.
+  InfoRec &getOrCreateNodeInfo(NodePtr N) {
+    auto [InfoIt, Inserted] = NodeToInfo.try_emplace(N, NodeInfos.size());
+    if (Inserted)
+      NodeInfos.emplace_back();
+    return NodeInfos[InfoIt->second];
+  }
 
-    return InfoIt->second.IDom;
+  NodePtr getIDom(NodePtr BB) {
+    InfoRec *Info = getNodeInfo(BB);
+    return Info ? Info->IDom : nullptr;
   }
 
   TreeNodePtr getNodeForBlock(NodePtr BB, DomTreeT &DT) {
@@ -181,11 +202,11 @@ struct SemiNCAInfo {
                   const NodeOrderMap *SuccOrder = nullptr) {
     assert(V);
     SmallVector<NodePtr, 64> WorkList = {V};
-    NodeToInfo[V].Parent = AttachToNum;
+    getOrCreateNodeInfo(V).Parent = AttachToNum;
 
     while (!WorkList.empty()) {
       const NodePtr BB = WorkList.pop_back_val();
-      auto &BBInfo = NodeToInfo[BB];
+      auto &BBInfo = getOrCreateNodeInfo(BB);
 
       // Visited nodes always have positive DFS numbers.
       if (BBInfo.DFSNum != 0) continue;
@@ -201,11 +222,11 @@ struct SemiNCAInfo {
             });
 
       for (const NodePtr Succ : Successors) {
-        const auto SIT = NodeToInfo.find(Succ);
+        InfoRec *SuccInfo = getNodeInfo(Succ);
         // Don't visit nodes more than once but remember to collect
         // ReverseChildren.
-        if (SIT != NodeToInfo.end() && SIT->second.DFSNum != 0) {
-          if (Succ != BB) SIT->second.ReverseChildren.push_back(LastNum);
+        if (SuccInfo && SuccInfo->DFSNum != 0) {
+          if (Succ != BB) SuccInfo->ReverseChildren.push_back(LastNum);
           continue;
         }
 
@@ -213,10 +234,11 @@ struct SemiNCAInfo {
 
         // It's fine to add Succ to the map, because we know that it will be
         // visited later.
-        auto &SuccInfo = NodeToInfo[Succ];
+        if (!SuccInfo)
+          SuccInfo = &getOrCreateNodeInfo(Succ);
         WorkList.push_back(Succ);
-        SuccInfo.Parent = LastNum;
-        SuccInfo.ReverseChildren.push_back(LastNum);
+        SuccInfo->Parent = LastNum;
+        SuccInfo->ReverseChildren.push_back(LastNum);
       }
     }
 
@@ -235,7 +257,7 @@ struct SemiNCAInfo {
   // and Child) and is unlikely to be faster than the simple implementation.
   //
   // For each vertex V, its Label points to the vertex with the minimal sdom(U)
-  // (Semi) in its path from V (included) to NodeToInfo[V].Parent (excluded).
+  // (Semi) in its path from V (included) to NumToInfo[V]->Parent (excluded).
   unsigned eval(unsigned V, unsigned LastLinked,
                 SmallVectorImpl<InfoRec *> &Stack,
                 ArrayRef<InfoRec *> NumToInfo) {
@@ -275,7 +297,7 @@ struct SemiNCAInfo {
     // Initialize IDoms to spanning tree parents.
     for (unsigned i = 1; i < NextDFSNum; ++i) {
       const NodePtr V = NumToNode[i];
-      auto &VInfo = NodeToInfo[V];
+      auto &VInfo = *getNodeInfo(V);
       VInfo.IDom = NumToNode[VInfo.Parent];
       NumToInfo.push_back(&VInfo);
     }
@@ -303,7 +325,7 @@ struct SemiNCAInfo {
       const unsigned SDomNum = NumToInfo[WInfo.Semi]->DFSNum;
       NodePtr WIDomCandidate = WInfo.IDom;
       while (true) {
-        auto &WIDomCandidateInfo = NodeToInfo.find(WIDomCandidate)->second;
+        auto &WIDomCandidateInfo = *getNodeInfo(WIDomCandidate);
         if (WIDomCandidateInfo.DFSNum <= SDomNum)
           break;
         WIDomCandidate = WIDomCandidateInfo.IDom;
@@ -322,7 +344,7 @@ struct SemiNCAInfo {
     assert(IsPostDom && "Only postdominators have a virtual root");
     assert(NumToNode.size() == 1 && "SNCAInfo must be freshly constructed");
 
-    auto &BBInfo = NodeToInfo[nullptr];
+    auto &BBInfo = getOrCreateNodeInfo(nullptr);
     BBInfo.DFSNum = BBInfo.Semi = BBInfo.Label = 1;
 
     NumToNode.push_back(nullptr);  // NumToNode[1] = nullptr;
@@ -447,6 +469,7 @@ struct SemiNCAInfo {
             InitSuccOrderOnce();
           assert(SuccOrder);
 
+          const size_t PrevNumInfos = SNCA.NodeInfos.size();
           const unsigned NewNum =
               SNCA.runDFS<true>(I, Num, AlwaysDescend, Num, &*SuccOrder);
           const NodePtr FurthestAway = SNCA.NumToNode[NewNum];
@@ -463,6 +486,10 @@ struct SemiNCAInfo {
             SNCA.NodeToInfo.erase(N);
             SNCA.NumToNode.pop_back();
           }
+          // The forward DFS only created records for the nodes it visited,
+          // which were all just erased, so their records are the last ones.
+          SNCA.NodeInfos.truncate(PrevNumInfos);
+          assert(SNCA.NodeInfos.size() == SNCA.NodeToInfo.size());
           const unsigned PrevNum = Num;
           LLVM_DEBUG(dbgs() << "\t\t\tRunning reverse DFS\n");
           Num = SNCA.runDFS(FurthestAway, Num, AlwaysDescend, 1);
@@ -593,7 +620,7 @@ struct SemiNCAInfo {
 
   void attachNewSubtree(DomTreeT& DT, const TreeNodePtr AttachTo) {
     // Attach the first unreachable block to AttachTo.
-    NodeToInfo[NumToNode[1]].IDom = AttachTo->getBlock();
+    getOrCreateNodeInfo(NumToNode[1]).IDom = AttachTo->getBlock();
     // Loop over all of the discovered blocks in the function...
     for (size_t i = 1, e = NumToNode.size(); i != e; ++i) {
       NodePtr W = NumToNode[i];
@@ -613,12 +640,12 @@ struct SemiNCAInfo {
   }
 
   void reattachExistingSubtree(DomTreeT &DT, const TreeNodePtr AttachTo) {
-    NodeToInfo[NumToNode[1]].IDom = AttachTo->getBlock();
+    getOrCreateNodeInfo(NumToNode[1]).IDom = AttachTo->getBlock();
     for (size_t i = 1, e = NumToNode.size(); i != e; ++i) {
       const NodePtr N = NumToNode[i];
       const TreeNodePtr TN = DT.getNode(N);
       assert(TN);
-      const TreeNodePtr NewIDom = DT.getNode(NodeToInfo[N].IDom);
+      const TreeNodePtr NewIDom = DT.getNode(getOrCreateNodeInfo(N).IDom);
       TN->setIDom(NewIDom);
     }
   }
@@ -0,0 +1,85 @@
+//===- llvm/Support/Jobserver.h - GNU make jobserver client -----*- C++ -*-===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// This file declares a client for the jobserver protocol of GNU make, which is
+// also implemented by ninja. A jobserver limits the total number of jobs run by
+// a build and all the processes it spawns. Every process owns one implicit job
+// slot; additional slots are tokens taken from the jobserver, which are given
+// back when the job is done. The jobserver is described by MAKEFLAGS as
+// --jobserver-auth=R,W (a pipe) or --jobserver-auth=fifo:PATH (a named pipe).
+// Only Unix is supported.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef LLVM_SUPPORT_JOBSERVER_H
+#define LLVM_SUPPORT_JOBSERVER_H
+
+#include "llvm/ADT/SmallVector.h"
+#include "llvm/ADT/StringRef.h"
+
+#include <mutex>
+
+namespace llvm {
+
+class JobserverClient {
+public:
+  /// Returns the client for the jobserver described by the MAKEFLAGS
+  /// environment variable, or nullptr if there is none or it can't be used.
+  static JobserverClient *getInstance();
+
+  /// Takes a job slot, blocking until one is available. Returns false if the
+  /// jobserver could not be read, in which case no slot was taken.
+  bool acquire();
+
+  /// Gives back a job slot taken by a successful call to acquire().
+  void release();
+
+private:
+  JobserverClient() = default;
+
+  enum class ReadResult { Token, Woken, Error };
+
+  /// Platform specific parts.
+  bool connect(StringRef Auth);
+  /// Waits for a token, or for wake() to be called.
+  ReadResult readToken(char &Token);
+  void writeToken(char Token);
+  /// Wakes up a thread waiting in readToken().
+  void wake();
+
+  std::mutex Mutex;
+  bool ImplicitSlotFree = true;
+  /// Number of threads waiting for a token.
+  unsigned Waiters = 0;
+  /// Tokens read from the jobserver, to be written back on release.
+  SmallVector<char, 0> Tokens;
+  int ReadFD = -1;
+  int WriteFD = -1;
+  /// A pipe used to wake up waiting threads when the implicit slot is freed.
+  int WakeFDs[2] = {-1, -1};
+};
+
+/// Holds a job slot of the jobserver, if there is one, for the lifetime of the
+/// object. A thread that already holds a slot, e.g. because it runs a task
+/// while waiting for other tasks, doesn't take another one.
+class JobserverSlot {
+public:
+  explicit JobserverSlot(bool Enable = true);
+  ~JobserverSlot();
+
+  JobserverSlot(const JobserverSlot &) = delete;
+  JobserverSlot &operator=(const JobserverSlot &) = delete;
+
+private:
+  bool Enabled;
+  bool Acquired = false;
+};
+
+} // namespace llvm
+
+#endif // LLVM_SUPPORT_JOBSERVER_H
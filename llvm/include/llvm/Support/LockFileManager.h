@@ -76,6 +76,11 @@ public:
 
   operator LockFileState() const { return getState(); }
 
+  /// Determine whether a process that is still running holds the lock for
+  /// \p FileName, without trying to take it. A lock file left behind by a
+  /// process that died is removed.
+  static bool isLocked(StringRef FileName);
+
   /// For a shared lock, wait until the owner releases the lock.
   /// Total timeout for the file to appear is ~1.5 minutes.
   /// \param MaxSeconds the maximum total wait time in seconds.
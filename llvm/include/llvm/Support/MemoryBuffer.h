@@ -35,6 +35,7 @@ using file_t = void *;
 #else
 using file_t = int;
 #endif
+enum class access_hint;
 } // namespace fs
 } // namespace sys
 
@@ -82,6 +83,12 @@ public:
   /// function should not be called on a writable buffer.
   virtual void dontNeedIfMmap() {}
 
+  /// For MemoryBuffer_MMap, tell the kernel how the buffer is going to be
+  /// accessed, e.g. to start reading a file from a slow file system in before
+  /// it is parsed. This calls madvise() on *NIX systems and does nothing for
+  /// buffers that are not file mappings.
+  virtual void adviseIfMmap(sys::fs::access_hint Hint) {}
+
   /// Open the specified file as a MemoryBuffer, returning a new MemoryBuffer
   /// if successful, otherwise returning null.
   ///
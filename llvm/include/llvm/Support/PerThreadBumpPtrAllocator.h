@@ -9,12 +9,108 @@
 #ifndef LLVM_SUPPORT_PERTHREADBUMPPTRALLOCATOR_H
 #define LLVM_SUPPORT_PERTHREADBUMPPTRALLOCATOR_H
 
+#include "llvm/ADT/SmallVector.h"
 #include "llvm/Support/Allocator.h"
+#include "llvm/Support/MathExtras.h"
 #include "llvm/Support/Parallel.h"
+#include <mutex>
+#include <vector>
 
 namespace llvm {
 namespace parallel {
 
+/// SlabPool is a thread-safe source of slabs for BumpPtrAllocatorImpl. Slabs
+/// given back by one allocator, on Reset() or destruction, are kept and handed
+/// out again to whichever thread asks next, so that per-thread arenas which are
+/// repeatedly filled and reset don't go back to the system allocator each time.
+///
+/// Only power-of-two sized slabs are cached. Regular BumpPtrAllocatorImpl slabs
+/// always have such sizes, while custom-sized slabs for large objects usually
+/// don't and are freed immediately. The pool must outlive every allocator
+/// that draws from it.
+class SlabPool : public AllocatorBase<SlabPool> {
+public:
+  SlabPool() = default;
+  SlabPool(const SlabPool &) = delete;
+  SlabPool &operator=(const SlabPool &) = delete;
+  ~SlabPool() { releaseMemory(); }
+
+  using AllocatorBase<SlabPool>::Allocate;
+  using AllocatorBase<SlabPool>::Deallocate;
+
+  /// Return a cached slab of \a Size bytes if there is one, or allocate a new
+  /// one.
+  void *Allocate(size_t Size, size_t Alignment) {
+    if (isPowerOf2_64(Size)) {
+      std::lock_guard<std::mutex> Lock(Mutex);
+      if (FreeList *L = findFreeList(Size, Alignment))
+        if (!L->Slabs.empty())
+          return L->Slabs.pop_back_val();
+    }
+    return allocate_buffer(Size, Alignment);
+  }
+
+  /// Give a slab back to the pool.
+  void Deallocate(const void *Ptr, size_t Size, size_t Alignment) {
+    if (!isPowerOf2_64(Size)) {
+      deallocate_buffer(const_cast<void *>(Ptr), Size, Alignment);
+      return;
+    }
+    std::lock_guard<std::mutex> Lock(Mutex);
+    FreeList *L = findFreeList(Size, Alignment);
+    if (!L)
+      L = &FreeLists.emplace_back(FreeList{Size, Alignment, {}});
+    L->Slabs.push_back(const_cast<void *>(Ptr));
+  }
+
+  /// Free all cached slabs. Slabs which are in use by an allocator are not
+  /// affected.
+  void releaseMemory() {
+    std::lock_guard<std::mutex> Lock(Mutex);
+    for (FreeList &L : FreeLists)
+      for (void *Slab : L.Slabs)
+        deallocate_buffer(Slab, L.Size, L.Alignment);
+    FreeLists.clear();
+  }
+
+  /// Return the total size of the cached slabs.
+  size_t getCachedMemory() {
+    std::lock_guard<std::mutex> Lock(Mutex);
+    size_t Total = 0;
+    for (const FreeList &L : FreeLists)
+      Total += L.Size * L.Slabs.size();
+    return Total;
+  }
+
+private:
+  struct FreeList {
+    size_t Size;
+    size_t Alignment;
+    SmallVector<void *, 0> Slabs;
+  };
+
+  // There are only a handful of distinct slab sizes, so a linear search is
+  // cheaper than a map.
+  FreeList *findFreeList(size_t Size, size_t Alignment) {
+    for (FreeList &L : FreeLists)
+      if (L.Size == Size && L.Alignment == Alignment)
+        return &L;
+    return nullptr;
+  }
+
+  std::mutex Mutex;
+  SmallVector<FreeList, 4> FreeLists;
+};
+
+namespace detail {
+/// An allocator aligned and padded to a (typical) cache line, so that the
+/// bump pointers of different threads' allocators never share a line.
+template <typename AllocatorTy>
+struct alignas(64) CacheLineAlignedAllocator : public AllocatorTy {
+  using AllocatorTy::AllocatorTy;
+};
+} // namespace detail
+
 /// PerThreadAllocator is used in conjunction with ThreadPoolExecutor to allow
 /// per-thread allocations. It wraps a possibly thread-unsafe allocator,
 /// e.g. BumpPtrAllocator. PerThreadAllocator must be used with only main thread
@@ -27,9 +123,23 @@ template <typename AllocatorTy>
 class PerThreadAllocator
     : public AllocatorBase<PerThreadAllocator<AllocatorTy>> {
 public:
-  PerThreadAllocator()
-      : NumOfAllocators(parallel::getThreadCount()),
-        Allocators(std::make_unique<AllocatorTy[]>(NumOfAllocators)) {}
+  PerThreadAllocator() : NumOfAllocators(parallel::getThreadCount()) {
+    Allocators.reserve(NumOfAllocators);
+    for (size_t Idx = 0; Idx < NumOfAllocators; Idx++)
+      Allocators.push_back(
+          std::make_unique<detail::CacheLineAlignedAllocator<AllocatorTy>>());
+  }
+
+  /// Create per-thread allocators which all take their slabs from \p Pool,
+  /// e.g. for AllocatorTy = BumpPtrAllocatorImpl<SlabPool &>.
+  explicit PerThreadAllocator(SlabPool &Pool)
+      : NumOfAllocators(parallel::getThreadCount()) {
+    Allocators.reserve(NumOfAllocators);
+    for (size_t Idx = 0; Idx < NumOfAllocators; Idx++)
+      Allocators.push_back(
+          std::make_unique<detail::CacheLineAlignedAllocator<AllocatorTy>>(
+              Pool));
+  }
 
   /// \defgroup Methods which could be called asynchronously:
   ///
@@ -42,20 +152,20 @@ public:
   /// Allocate \a Size bytes of \a Alignment aligned memory.
   void *Allocate(size_t Size, size_t Alignment) {
     assert(getThreadIndex() < NumOfAllocators);
-    return Allocators[getThreadIndex()].Allocate(Size, Alignment);
+    return Allocators[getThreadIndex()]->Allocate(Size, Alignment);
   }
 
   /// Deallocate \a Ptr to \a Size bytes of memory allocated by this
   /// allocator.
   void Deallocate(const void *Ptr, size_t Size, size_t Alignment) {
     assert(getThreadIndex() < NumOfAllocators);
-    return Allocators[getThreadIndex()].Deallocate(Ptr, Size, Alignment);
+    return Allocators[getThreadIndex()]->Deallocate(Ptr, Size, Alignment);
   }
 
   /// Return allocator corresponding to the current thread.
   AllocatorTy &getThreadLocalAllocator() {
     assert(getThreadIndex() < NumOfAllocators);
-    return Allocators[getThreadIndex()];
+    return *Allocators[getThreadIndex()];
   }
 
   // Return number of used allocators.
@@ -69,7 +179,7 @@ public:
   /// Reset state of allocators.
   void Reset() {
     for (size_t Idx = 0; Idx < getNumberOfAllocators(); Idx++)
-      Allocators[Idx].Reset();
+      Allocators[Idx]->Reset();
   }
 
   /// Return total memory size used by all allocators.
@@ -77,7 +187,7 @@ public:
     size_t TotalMemory = 0;
 
     for (size_t Idx = 0; Idx < getNumberOfAllocators(); Idx++)
-      TotalMemory += Allocators[Idx].getTotalMemory();
+      TotalMemory += Allocators[Idx]->getTotalMemory();
 
     return TotalMemory;
   }
@@ -87,7 +197,7 @@ public:
     size_t BytesAllocated = 0;
 
     for (size_t Idx = 0; Idx < getNumberOfAllocators(); Idx++)
-      BytesAllocated += Allocators[Idx].getBytesAllocated();
+      BytesAllocated += Allocators[Idx]->getBytesAllocated();
 
     return BytesAllocated;
   }
@@ -95,25 +205,68 @@ public:
   /// Set red zone for all allocators.
   void setRedZoneSize(size_t NewSize) {
     for (size_t Idx = 0; Idx < getNumberOfAllocators(); Idx++)
-      Allocators[Idx].setRedZoneSize(NewSize);
+      Allocators[Idx]->setRedZoneSize(NewSize);
   }
 
   /// Print statistic for each allocator.
   void PrintStats() const {
     for (size_t Idx = 0; Idx < getNumberOfAllocators(); Idx++) {
       errs() << "\n Allocator " << Idx << "\n";
-      Allocators[Idx].PrintStats();
+      Allocators[Idx]->PrintStats();
     }
   }
   /// @}
 
 protected:
   size_t NumOfAllocators;
-  std::unique_ptr<AllocatorTy[]> Allocators;
+  std::vector<std::unique_ptr<detail::CacheLineAlignedAllocator<AllocatorTy>>>
+      Allocators;
 };
 
 using PerThreadBumpPtrAllocator = PerThreadAllocator<BumpPtrAllocator>;
 
+/// A PerThreadBumpPtrAllocator whose threads share one SlabPool.
+using PooledPerThreadBumpPtrAllocator =
+    PerThreadAllocator<BumpPtrAllocatorImpl<SlabPool &>>;
+
+/// The per-thread counterpart of SpecificBumpPtrAllocator: objects of type T
+/// are allocated without locking from the current thread's arena, and
+/// DestroyAll() runs the destructors of the objects of all threads. The same
+/// restrictions on the calling threads as for PerThreadAllocator apply.
+template <typename T> class PerThreadSpecificBumpPtrAllocator {
+public:
+  PerThreadSpecificBumpPtrAllocator()
+      : NumOfAllocators(parallel::getThreadCount()) {
+    Allocators.reserve(NumOfAllocators);
+    for (size_t Idx = 0; Idx < NumOfAllocators; Idx++)
+      Allocators.push_back(std::make_unique<detail::CacheLineAlignedAllocator<
+                               SpecificBumpPtrAllocator<T>>>());
+  }
+
+  /// Allocate space for an array of objects without constructing them. This
+  /// could be called asynchronously.
+  T *Allocate(size_t Num = 1) {
+    assert(getThreadIndex() < NumOfAllocators);
+    return Allocators[getThreadIndex()]->Allocate(Num);
+  }
+
+  /// Call the destructor of each allocated object of every thread. This could
+  /// not be called asynchronously.
+  void DestroyAll() {
+    for (size_t Idx = 0; Idx < NumOfAllocators; Idx++)
+      Allocators[Idx]->DestroyAll();
+  }
+
+  // Return number of used allocators.
+  size_t getNumberOfAllocators() const { return NumOfAllocators; }
+
+protected:
+  size_t NumOfAllocators;
+  std::vector<std::unique_ptr<
+      detail::CacheLineAlignedAllocator<SpecificBumpPtrAllocator<T>>>>
+      Allocators;
+};
+
 } // end namespace parallel
 } // end namespace llvm
 
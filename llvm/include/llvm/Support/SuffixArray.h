@@ -0,0 +1,64 @@
+//===- llvm/Support/SuffixArray.h - Suffix array for substrings -*- C++ -*-===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+// A compact alternative to SuffixTree for finding repeated substrings.
+//
+// A suffix array is the list of start indices of the suffixes of a string in
+// lexicographic order. Together with the longest common prefix (LCP) of each
+// pair of adjacent suffixes it encodes the same information as a suffix tree:
+// every internal node of the tree corresponds to an "LCP interval", a maximal
+// range of the array whose suffixes all share a prefix of some length. See
+// "Replacing suffix trees with enhanced suffix arrays" by Abouelhoda, Kurtz
+// and Ohlebusch.
+//
+// The array and the LCP table take a few words per input element, rather
+// than the node objects and child maps of a SuffixTree, which makes it usable
+// on module-sized inputs. The array is built by prefix doubling, which sorts
+// with parallelSort and so uses the threads given to llvm::parallel.
+//
+// The repeated substrings found are those the SuffixTree iterator reports
+// for an input that ends in a unique element: for every internal node, the
+// suffixes which are leaf children of that node. Without a unique terminator
+// the array also reports substrings that are prefixes of later suffixes,
+// which the tree leaves implicit.
+//===----------------------------------------------------------------------===//
+
+#ifndef LLVM_SUPPORT_SUFFIXARRAY_H
+#define LLVM_SUPPORT_SUFFIXARRAY_H
+
+#include "llvm/ADT/ArrayRef.h"
+#include "llvm/Support/SuffixTree.h"
+#include <vector>
+
+namespace llvm {
+class SuffixArray {
+public:
+  using RepeatedSubstring = SuffixTree::RepeatedSubstring;
+
+  /// The minimum length of a repeated substring to find. This matches the
+  /// SuffixTree iterator.
+  static constexpr unsigned MinLength = 2;
+
+private:
+  /// Every repeated substring in the input.
+  std::vector<RepeatedSubstring> RepeatedSubstrings;
+
+public:
+  /// Construct a suffix array from a sequence of unsigned integers and find
+  /// its repeated substrings.
+  ///
+  /// \param Str The string to construct the suffix array for.
+  SuffixArray(ArrayRef<unsigned> Str);
+
+  using iterator = std::vector<RepeatedSubstring>::iterator;
+  iterator begin() { return RepeatedSubstrings.begin(); }
+  iterator end() { return RepeatedSubstrings.end(); }
+};
+
+} // namespace llvm
+
+#endif // LLVM_SUPPORT_SUFFIXARRAY_H
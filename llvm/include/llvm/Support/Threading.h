@@ -129,6 +129,12 @@ constexpr bool llvm_is_multithreaded() { return LLVM_ENABLE_THREADS; }
     // threads, or hardware cores.
     bool Limit = false;
 
+    // If set, every task holds a job slot of the GNU make / ninja jobserver
+    // described by MAKEFLAGS while it runs, so that the total number of jobs
+    // of the build is honored. Has no effect if there is no usable
+    // jobserver, or on systems other than Unix.
+    bool UseJobserver = false;
+
     /// Retrieves the max available threads for the current strategy. This
     /// accounts for affinity masks and takes advantage of all CPU sockets.
     unsigned compute_thread_count() const;
@@ -149,6 +155,8 @@ constexpr bool llvm_is_multithreaded() { return LLVM_ENABLE_THREADS; }
   /// strategy, we attempt to equally allocate the threads on all CPU sockets.
   /// "0" or an empty string will return the \p Default strategy.
   /// "all" for using all hardware threads.
+  /// "jobserver" for using all hardware threads, but only as many at a time as
+  /// the jobserver of the parent build allows.
   std::optional<ThreadPoolStrategy>
   get_threadpool_strategy(StringRef Num, ThreadPoolStrategy Default = {});
 
@@ -81,6 +81,7 @@
 
 namespace llvm {
 
+class raw_ostream;
 class raw_pwrite_stream;
 
 struct TimeTraceProfiler;
@@ -88,11 +89,24 @@ TimeTraceProfiler *getTimeTraceProfilerInstance();
 
 struct TimeTraceProfilerEntry;
 
+/// What the time trace profiler records.
+enum class TimeTraceProfilerMode {
+  /// Record every entry that lasts at least the time trace granularity, for
+  /// the Chrome trace viewer.
+  Events,
+  /// Only aggregate entries into a per-thread call tree of counts, total and
+  /// self times. Details are not computed and no per-entry data is kept, so
+  /// the overhead stays low even for huge inputs. The JSON output then only
+  /// contains the "Total" events.
+  Summary,
+};
+
 /// Initialize the time trace profiler.
 /// This sets up the global \p TimeTraceProfilerInstance
 /// variable to be the profiler instance.
-void timeTraceProfilerInitialize(unsigned TimeTraceGranularity,
-                                 StringRef ProcName);
+void timeTraceProfilerInitialize(
+    unsigned TimeTraceGranularity, StringRef ProcName,
+    TimeTraceProfilerMode Mode = TimeTraceProfilerMode::Events);
 
 /// Cleanup the time trace profiler, if it was initialized.
 void timeTraceProfilerCleanup();
@@ -110,6 +124,11 @@ inline bool timeTraceProfilerEnabled() {
 /// https://docs.google.com/document/d/1CvAClvFfyA5R-PhYUmn5OOQtYMH4h6I0nSsKchNAySU/preview
 void timeTraceProfilerWrite(raw_pwrite_stream &OS);
 
+/// Write the call tree of each thread to output stream, as an indented table
+/// with the count, total and self time of every distinct path of nested entry
+/// names. The call tree is only recorded in TimeTraceProfilerMode::Summary.
+void timeTraceProfilerWriteSummary(raw_ostream &OS);
+
 /// Write profiling data to a file.
 /// The function will write to \p PreferredFileName if provided, if not
 /// then will write to \p FallbackFileName appending .time-trace.
@@ -34,6 +34,7 @@ class format_object_base;
 class FormattedString;
 class FormattedNumber;
 class FormattedBytes;
+class Error;
 template <class T> class [[nodiscard]] Expected;
 
 namespace sys {
@@ -42,6 +43,8 @@ enum FileAccess : unsigned;
 enum OpenFlags : unsigned;
 enum CreationDisposition : unsigned;
 class FileLocker;
+class mapped_file_region;
+class TempFile;
 } // end namespace fs
 } // end namespace sys
 
@@ -648,6 +651,53 @@ public:
   static bool classof(const raw_ostream *OS);
 };
 
+/// A raw_pwrite_stream that writes into a memory-mapped temporary file next to
+/// the output file. The mapping grows as data is streamed out, so the final
+/// size need not be known up front. The stream's buffer points into the
+/// mapping itself, so data is copied once into the page cache instead of into
+/// a user-space buffer and then again by write(2).
+///
+/// The file atomically replaces the output file on commit(). If the stream is
+/// destroyed without being committed, the temporary file is deleted.
+class raw_mmap_ostream : public raw_pwrite_stream {
+public:
+  /// Create a stream that writes to \p Filename. \p SizeHint is the expected
+  /// output size, if known. Fails if the output can't be memory-mapped, e.g.
+  /// for "-" or special files, in which case callers should fall back to
+  /// raw_fd_ostream.
+  static Expected<std::unique_ptr<raw_mmap_ostream>>
+  create(StringRef Filename, size_t SizeHint = 0);
+
+  ~raw_mmap_ostream() override;
+
+  /// Flush the stream, trim the file to the number of bytes written and move
+  /// it to its final path. The stream must not be written to afterwards.
+  Error commit();
+
+  /// Return the error, if any, that occurred while growing the mapping. Once
+  /// an error occurred, further output is discarded and commit() fails.
+  std::error_code error() const { return EC; }
+
+private:
+  raw_mmap_ostream(StringRef Filename, sys::fs::TempFile Temp);
+
+  void write_impl(const char *Ptr, size_t Size) override;
+  void pwrite_impl(const char *Ptr, size_t Size, uint64_t Offset) override;
+  uint64_t current_pos() const override { return Pos; }
+
+  /// Remap the file so that it can hold at least \p MinSize bytes.
+  std::error_code reserve(uint64_t MinSize);
+
+  /// Point the stream's buffer at the unused part of the mapping.
+  void resetBuffer();
+
+  std::string FinalPath;
+  std::unique_ptr<sys::fs::TempFile> Temp;
+  std::unique_ptr<sys::fs::mapped_file_region> Region;
+  uint64_t Pos = 0;
+  std::error_code EC;
+};
+
 //===----------------------------------------------------------------------===//
 // Output Stream Adaptors
 //===----------------------------------------------------------------------===//
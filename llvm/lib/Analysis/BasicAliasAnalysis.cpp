@@ -1506,6 +1506,18 @@ AliasResult BasicAAResult::aliasPHI(const PHINode *PN, LocationSize PNSize,
   return Alias;
 }
 
+/// Return the underlying object of \p V, reusing the result of an earlier
+/// query in the same batch if there was one.
+static const Value *getUnderlyingObjectCached(const Value *V,
+                                             AAQueryInfo &AAQI) {
+  if (!AAQI.UnderlyingObjects)
+    return getUnderlyingObject(V, MaxLookupSearchDepth);
+  auto [It, Inserted] = AAQI.UnderlyingObjects->try_emplace(V, nullptr);
+  if (Inserted)
+    It->second = getUnderlyingObject(V, MaxLookupSearchDepth);
+  return It->second;
+}
+
 /// Provides a bunch of ad-hoc rules to disambiguate in common cases, such as
 /// array references.
 AliasResult BasicAAResult::aliasCheck(const Value *V1, LocationSize V1Size,
@@ -1539,8 +1551,8 @@ AliasResult BasicAAResult::aliasCheck(const Value *V1, LocationSize V1Size,
     return AliasResult::NoAlias; // Scalars cannot alias each other
 
   // Figure out what objects these things are pointing to if we can.
-  const Value *O1 = getUnderlyingObject(V1, MaxLookupSearchDepth);
-  const Value *O2 = getUnderlyingObject(V2, MaxLookupSearchDepth);
+  const Value *O1 = getUnderlyingObjectCached(V1, AAQI);
+  const Value *O2 = getUnderlyingObjectCached(V2, AAQI);
 
   // Null values in the default address space don't point to any object, so they
   // don't alias any other pointer.
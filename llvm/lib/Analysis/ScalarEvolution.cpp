@@ -142,6 +142,10 @@ STATISTIC(NumExitCountsNotComputed,
           "Number of loop exits without predictable exit counts");
 STATISTIC(NumBruteForceTripCountsComputed,
           "Number of loops with trip counts computed by force");
+STATISTIC(NumForgottenSCEVs,
+          "Number of SCEVs whose memoized results were invalidated");
+STATISTIC(NumKeptPredicatedRewrites,
+          "Number of predicated SCEV rewrites kept by invalidation sweeps");
 
 #ifdef EXPENSIVE_CHECKS
 bool llvm::VerifySCEV = true;
@@ -8423,6 +8427,7 @@ void ScalarEvolution::forgetLoop(const Loop *L) {
   SmallVector<Instruction *, 32> Worklist;
   SmallPtrSet<Instruction *, 16> Visited;
   SmallVector<const SCEV *, 16> ToForget;
+  SmallPtrSet<const Loop *, 8> ForgottenLoops;
 
   // Iterate over all the loops and sub-loops to drop SCEV information.
   while (!LoopWorklist.empty()) {
@@ -8432,15 +8437,7 @@ void ScalarEvolution::forgetLoop(const Loop *L) {
     forgetBackedgeTakenCounts(CurrL, /* Predicated */ false);
     forgetBackedgeTakenCounts(CurrL, /* Predicated */ true);
 
-    // Drop information about predicated SCEV rewrites for this loop.
-    for (auto I = PredicatedSCEVRewrites.begin();
-         I != PredicatedSCEVRewrites.end();) {
-      std::pair<const SCEV *, const Loop *> Entry = I->first;
-      if (Entry.second == CurrL)
-        PredicatedSCEVRewrites.erase(I++);
-      else
-        ++I;
-    }
+    ForgottenLoops.insert(CurrL);
 
     auto LoopUsersItr = LoopUsers.find(CurrL);
     if (LoopUsersItr != LoopUsers.end()) {
@@ -8457,6 +8454,19 @@ void ScalarEvolution::forgetLoop(const Loop *L) {
     // ValuesAtScopes map.
     LoopWorklist.append(CurrL->begin(), CurrL->end());
   }
+
+  // Drop information about predicated SCEV rewrites for these loops. This is
+  // done in a single sweep rather than once per loop in the nest.
+  for (auto I = PredicatedSCEVRewrites.begin();
+       I != PredicatedSCEVRewrites.end();) {
+    std::pair<const SCEV *, const Loop *> Entry = I->first;
+    if (ForgottenLoops.count(Entry.second)) {
+      PredicatedSCEVRewrites.erase(I++);
+    } else {
+      ++NumKeptPredicatedRewrites;
+      ++I;
+    }
+  }
   forgetMemoizedResults(ToForget);
 }
 
@@ -13908,6 +13918,9 @@ void ScalarEvolution::forgetBackedgeTakenCounts(const Loop *L,
 }
 
 void ScalarEvolution::forgetMemoizedResults(ArrayRef<const SCEV *> SCEVs) {
+  if (SCEVs.empty())
+    return;
+
   SmallPtrSet<const SCEV *, 8> ToForget(SCEVs.begin(), SCEVs.end());
   SmallVector<const SCEV *, 8> Worklist(ToForget.begin(), ToForget.end());
 
@@ -13920,16 +13933,19 @@ void ScalarEvolution::forgetMemoizedResults(ArrayRef<const SCEV *> SCEVs) {
           Worklist.push_back(User);
   }
 
+  NumForgottenSCEVs += ToForget.size();
   for (const auto *S : ToForget)
     forgetMemoizedResultsImpl(S);
 
   for (auto I = PredicatedSCEVRewrites.begin();
        I != PredicatedSCEVRewrites.end();) {
     std::pair<const SCEV *, const Loop *> Entry = I->first;
-    if (ToForget.count(Entry.first))
+    if (ToForget.count(Entry.first)) {
       PredicatedSCEVRewrites.erase(I++);
-    else
+    } else {
+      ++NumKeptPredicatedRewrites;
       ++I;
+    }
   }
 }
 
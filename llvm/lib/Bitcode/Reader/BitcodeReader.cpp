@@ -6878,18 +6878,19 @@ Error BitcodeReader::materialize(GlobalValue *GV) {
   if (DISubprogram *SP = MDLoader->lookupSubprogramForFunction(F))
     F->setSubprogram(SP);
 
-  // Check if the TBAA Metadata are valid, otherwise we will need to strip them.
-  if (!MDLoader->isStrippingTBAA()) {
-    for (auto &I : instructions(F)) {
+  // Make a single pass over the new body for all per-instruction checks and
+  // upgrades.
+  for (auto &I : instructions(F)) {
+    // Check if the TBAA Metadata are valid, otherwise we will need to strip
+    // them.
+    if (!MDLoader->isStrippingTBAA()) {
       MDNode *TBAA = I.getMetadata(LLVMContext::MD_tbaa);
-      if (!TBAA || TBAAVerifyHelper.visitTBAAMetadata(I, TBAA))
-        continue;
-      MDLoader->setStripTBAA(true);
-      stripTBAA(F->getParent());
+      if (TBAA && !TBAAVerifyHelper.visitTBAAMetadata(I, TBAA)) {
+        MDLoader->setStripTBAA(true);
+        stripTBAA(F->getParent());
+      }
     }
-  }
 
-  for (auto &I : instructions(F)) {
     // "Upgrade" older incorrect branch weights by dropping them.
     if (auto *MD = I.getMetadata(LLVMContext::MD_prof)) {
       if (MD->getOperand(0) != nullptr && isa<MDString>(MD->getOperand(0))) {
@@ -6918,14 +6919,19 @@ Error BitcodeReader::materialize(GlobalValue *GV) {
       }
     }
 
-    // Remove incompatible attributes on function calls.
+    // Remove incompatible attributes on function calls. Most positions carry
+    // no attributes, so skip building a mask for them.
     if (auto *CI = dyn_cast<CallBase>(&I)) {
-      CI->removeRetAttrs(AttributeFuncs::typeIncompatible(
-          CI->getFunctionType()->getReturnType()));
+      AttributeList Attrs = CI->getAttributes();
+      if (Attrs.hasRetAttrs())
+        CI->removeRetAttrs(AttributeFuncs::typeIncompatible(
+            CI->getFunctionType()->getReturnType()));
 
       for (unsigned ArgNo = 0; ArgNo < CI->arg_size(); ++ArgNo)
-        CI->removeParamAttrs(ArgNo, AttributeFuncs::typeIncompatible(
-                                        CI->getArgOperand(ArgNo)->getType()));
+        if (Attrs.hasParamAttrs(ArgNo))
+          CI->removeParamAttrs(ArgNo,
+                               AttributeFuncs::typeIncompatible(
+                                   CI->getArgOperand(ArgNo)->getType()));
     }
   }
 
@@ -45,6 +45,12 @@ struct MetadataLoaderCallbacks {
 };
 
 /// Helper class that handles loading Metadatas and keeping them available.
+///
+/// When importing, module-level metadata is loaded lazily: only the nodes an
+/// imported function refers to are read. Debug locations and other function
+/// local metadata are always read with the function body, because every
+/// DebugLoc must point to a uniqued DILocation as soon as its instruction
+/// exists; there is no placeholder for a location that is loaded later.
 class MetadataLoader {
   class MetadataLoaderImpl;
   std::unique_ptr<MetadataLoaderImpl> Pimpl;
@@ -4850,7 +4850,10 @@ void ModuleBitcodeWriter::write() {
   writeOperandBundleTags();
   writeSyncScopeNames();
 
-  // Emit function bodies.
+  // Emit function bodies. This is sequential: writeFunction incorporates each
+  // function's local values into the shared ValueEnumerator and purges them
+  // afterwards, and the VST offset recorded for each function block is a
+  // position in the single output stream.
   DenseMap<const Function *, uint64_t> FunctionToBitcodeIndex;
   for (const Function &F : M)
     if (!F.isDeclaration())
@@ -132,6 +132,10 @@ STATISTIC(NumRetsDup, "Number of return instructions duplicated");
 STATISTIC(NumDbgValueMoved, "Number of debug value instructions moved");
 STATISTIC(NumSelectsExpanded, "Number of selects turned into branches");
 STATISTIC(NumStoreExtractExposed, "Number of store(extractelement) exposed");
+STATISTIC(NumIterationRestarts,
+          "Number of block iterations restarted after a DomTree change");
+STATISTIC(NumBlocksNotRevisited,
+          "Number of unchanged blocks skipped when iterating huge functions");
 
 static cl::opt<bool> DisableBranchOpts(
     "disable-cgp-branch-opts", cl::Hidden, cl::init(false),
@@ -650,8 +654,10 @@ bool CodeGenPrepare::_run(Function &F) {
     MadeChange = false;
 
     for (BasicBlock &BB : llvm::make_early_inc_range(F)) {
-      if (FuncIterated && !FreshBBs.contains(&BB))
+      if (FuncIterated && !FreshBBs.contains(&BB)) {
+        ++NumBlocksNotRevisited;
         continue;
+      }
 
       ModifyDT ModifiedDTOnIteration = ModifyDT::NotModifyDT;
       bool Changed = optimizeBlock(BB, ModifiedDTOnIteration);
@@ -677,8 +683,10 @@ bool CodeGenPrepare::_run(Function &F) {
       } else {
         // For small/normal functions, we restart BB iteration if the dominator
         // tree of the Function was changed.
-        if (ModifiedDTOnIteration != ModifyDT::NotModifyDT)
+        if (ModifiedDTOnIteration != ModifyDT::NotModifyDT) {
+          ++NumIterationRestarts;
           break;
+        }
       }
     }
     // We have iterated all the BB in the (only work for huge) function.
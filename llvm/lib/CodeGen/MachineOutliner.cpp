@@ -63,6 +63,7 @@
 #include "llvm/CodeGen/LivePhysRegs.h"
 #include "llvm/CodeGen/MachineModuleInfo.h"
 #include "llvm/CodeGen/MachineOptimizationRemarkEmitter.h"
+#include "llvm/CodeGen/MachineStableHash.h"
 #include "llvm/CodeGen/Passes.h"
 #include "llvm/CodeGen/TargetInstrInfo.h"
 #include "llvm/CodeGen/TargetSubtargetInfo.h"
@@ -72,6 +73,7 @@
 #include "llvm/InitializePasses.h"
 #include "llvm/Support/CommandLine.h"
 #include "llvm/Support/Debug.h"
+#include "llvm/Support/SuffixArray.h"
 #include "llvm/Support/SuffixTree.h"
 #include "llvm/Support/raw_ostream.h"
 #include <functional>
@@ -116,11 +118,22 @@ static cl::opt<unsigned> OutlinerReruns(
     cl::desc(
         "Number of times to rerun the outliner after the initial outline"));
 
+static cl::opt<bool> OutlinerUseSuffixArray(
+    "outliner-use-suffix-array", cl::init(false), cl::Hidden,
+    cl::desc("Find repeated sequences with a suffix array instead of a suffix "
+             "tree. Uses much less memory on large modules, at some cost in "
+             "compile time"));
+
 static cl::opt<unsigned> OutlinerBenefitThreshold(
     "outliner-benefit-threshold", cl::init(1), cl::Hidden,
     cl::desc(
         "The minimum size in bytes before an outlining candidate is accepted"));
 
+static cl::opt<bool> OutlinerSequenceHashRemarks(
+    "outliner-sequence-hash-remarks", cl::init(false), cl::Hidden,
+    cl::desc("Emit an analysis remark with a hash of each outlined sequence "
+             "that is stable across modules and builds"));
+
 namespace {
 
 /// Maps \p MachineInstrs to unsigned integers and stores the mappings.
@@ -449,6 +462,14 @@ struct MachineOutliner : public ModulePass {
   void findCandidates(InstructionMapper &Mapper,
                       std::vector<OutlinedFunction> &FunctionList);
 
+  /// Collect the non-overlapping occurrences of the repeated substring \p RS
+  /// and, if outlining them is beneficial, add an OutlinedFunction for them to
+  /// \p FunctionList. \p CandidatesForRepeatedSeq is scratch space.
+  void findCandidatesForRepeatedSubstring(
+      InstructionMapper &Mapper, const SuffixTree::RepeatedSubstring &RS,
+      std::vector<Candidate> &CandidatesForRepeatedSeq,
+      std::vector<OutlinedFunction> &FunctionList);
+
   /// Replace the sequences of instructions represented by \p OutlinedFunctions
   /// with calls to functions.
   ///
@@ -571,111 +592,141 @@ void MachineOutliner::emitOutlinedFunctionRemark(OutlinedFunction &OF) {
   R << ")";
 
   MORE.emit(R);
-}
 
-void MachineOutliner::findCandidates(
-    InstructionMapper &Mapper, std::vector<OutlinedFunction> &FunctionList) {
-  FunctionList.clear();
-  SuffixTree ST(Mapper.UnsignedVec);
+  if (!OutlinerSequenceHashRemarks)
+    return;
+
+  // A hash of the outlined sequence that is stable across modules and builds,
+  // so that remarks from separate codegen runs can be matched up to find
+  // sequences repeated in more than one module.
+  SmallVector<stable_hash> InstrHashes;
+  for (const MachineInstr &MI : OF.Candidates.front())
+    InstrHashes.push_back(stableHashValue(MI));
+  MachineOptimizationRemarkAnalysis H(DEBUG_TYPE, "OutlinedSequenceHash",
+                                      MBB->findDebugLoc(MBB->begin()), MBB);
+  H << "Sequence hash: "
+    << NV("SequenceHash",
+          stable_hash_combine_range(InstrHashes.begin(), InstrHashes.end()));
+  MORE.emit(H);
+}
 
-  // First, find all of the repeated substrings in the tree of minimum length
-  // 2.
-  std::vector<Candidate> CandidatesForRepeatedSeq;
-  LLVM_DEBUG(dbgs() << "*** Discarding overlapping candidates *** \n");
-  LLVM_DEBUG(
-      dbgs() << "Searching for overlaps in all repeated sequences...\n");
-  for (const SuffixTree::RepeatedSubstring &RS : ST) {
-    CandidatesForRepeatedSeq.clear();
-    unsigned StringLen = RS.Length;
-    LLVM_DEBUG(dbgs() << "  Sequence length: " << StringLen << "\n");
-    // Debug code to keep track of how many candidates we removed.
+void MachineOutliner::findCandidatesForRepeatedSubstring(
+    InstructionMapper &Mapper, const SuffixTree::RepeatedSubstring &RS,
+    std::vector<Candidate> &CandidatesForRepeatedSeq,
+    std::vector<OutlinedFunction> &FunctionList) {
+  CandidatesForRepeatedSeq.clear();
+  unsigned StringLen = RS.Length;
+  LLVM_DEBUG(dbgs() << "  Sequence length: " << StringLen << "\n");
+  // Debug code to keep track of how many candidates we removed.
 #ifndef NDEBUG
-    unsigned NumDiscarded = 0;
-    unsigned NumKept = 0;
+  unsigned NumDiscarded = 0;
+  unsigned NumKept = 0;
 #endif
-    for (const unsigned &StartIdx : RS.StartIndices) {
-      // Trick: Discard some candidates that would be incompatible with the
-      // ones we've already found for this sequence. This will save us some
-      // work in candidate selection.
-      //
-      // If two candidates overlap, then we can't outline them both. This
-      // happens when we have candidates that look like, say
-      //
-      // AA (where each "A" is an instruction).
-      //
-      // We might have some portion of the module that looks like this:
-      // AAAAAA (6 A's)
-      //
-      // In this case, there are 5 different copies of "AA" in this range, but
-      // at most 3 can be outlined. If only outlining 3 of these is going to
-      // be unbeneficial, then we ought to not bother.
-      //
-      // Note that two things DON'T overlap when they look like this:
-      // start1...end1 .... start2...end2
-      // That is, one must either
-      // * End before the other starts
-      // * Start after the other ends
-      unsigned EndIdx = StartIdx + StringLen - 1;
-      auto FirstOverlap = find_if(
-          CandidatesForRepeatedSeq, [StartIdx, EndIdx](const Candidate &C) {
-            return EndIdx >= C.getStartIdx() && StartIdx <= C.getEndIdx();
-          });
-      if (FirstOverlap != CandidatesForRepeatedSeq.end()) {
+  for (const unsigned &StartIdx : RS.StartIndices) {
+    // Trick: Discard some candidates that would be incompatible with the
+    // ones we've already found for this sequence. This will save us some
+    // work in candidate selection.
+    //
+    // If two candidates overlap, then we can't outline them both. This
+    // happens when we have candidates that look like, say
+    //
+    // AA (where each "A" is an instruction).
+    //
+    // We might have some portion of the module that looks like this:
+    // AAAAAA (6 A's)
+    //
+    // In this case, there are 5 different copies of "AA" in this range, but
+    // at most 3 can be outlined. If only outlining 3 of these is going to
+    // be unbeneficial, then we ought to not bother.
+    //
+    // Note that two things DON'T overlap when they look like this:
+    // start1...end1 .... start2...end2
+    // That is, one must either
+    // * End before the other starts
+    // * Start after the other ends
+    unsigned EndIdx = StartIdx + StringLen - 1;
+    auto FirstOverlap = find_if(
+        CandidatesForRepeatedSeq, [StartIdx, EndIdx](const Candidate &C) {
+          return EndIdx >= C.getStartIdx() && StartIdx <= C.getEndIdx();
+        });
+    if (FirstOverlap != CandidatesForRepeatedSeq.end()) {
 #ifndef NDEBUG
-        ++NumDiscarded;
-        LLVM_DEBUG(dbgs() << "    .. DISCARD candidate @ [" << StartIdx
-                          << ", " << EndIdx << "]; overlaps with candidate @ ["
-                          << FirstOverlap->getStartIdx() << ", "
-                          << FirstOverlap->getEndIdx() << "]\n");
+      ++NumDiscarded;
+      LLVM_DEBUG(dbgs() << "    .. DISCARD candidate @ [" << StartIdx
+                        << ", " << EndIdx << "]; overlaps with candidate @ ["
+                        << FirstOverlap->getStartIdx() << ", "
+                        << FirstOverlap->getEndIdx() << "]\n");
 #endif
-        continue;
-      }
-      // It doesn't overlap with anything, so we can outline it.
-      // Each sequence is over [StartIt, EndIt].
-      // Save the candidate and its location.
+      continue;
+    }
+    // It doesn't overlap with anything, so we can outline it.
+    // Each sequence is over [StartIt, EndIt].
+    // Save the candidate and its location.
 #ifndef NDEBUG
-      ++NumKept;
+    ++NumKept;
 #endif
-      MachineBasicBlock::iterator StartIt = Mapper.InstrList[StartIdx];
-      MachineBasicBlock::iterator EndIt = Mapper.InstrList[EndIdx];
-      MachineBasicBlock *MBB = StartIt->getParent();
-      CandidatesForRepeatedSeq.emplace_back(StartIdx, StringLen, StartIt, EndIt,
-                                            MBB, FunctionList.size(),
-                                            Mapper.MBBFlagsMap[MBB]);
-    }
+    MachineBasicBlock::iterator StartIt = Mapper.InstrList[StartIdx];
+    MachineBasicBlock::iterator EndIt = Mapper.InstrList[EndIdx];
+    MachineBasicBlock *MBB = StartIt->getParent();
+    CandidatesForRepeatedSeq.emplace_back(StartIdx, StringLen, StartIt, EndIt,
+                                          MBB, FunctionList.size(),
+                                          Mapper.MBBFlagsMap[MBB]);
+  }
 #ifndef NDEBUG
-    LLVM_DEBUG(dbgs() << "    Candidates discarded: " << NumDiscarded
-                      << "\n");
-    LLVM_DEBUG(dbgs() << "    Candidates kept: " << NumKept << "\n\n");
+  LLVM_DEBUG(dbgs() << "    Candidates discarded: " << NumDiscarded
+                    << "\n");
+  LLVM_DEBUG(dbgs() << "    Candidates kept: " << NumKept << "\n\n");
 #endif
 
-    // We've found something we might want to outline.
-    // Create an OutlinedFunction to store it and check if it'd be beneficial
-    // to outline.
-    if (CandidatesForRepeatedSeq.size() < 2)
-      continue;
-
-    // Arbitrarily choose a TII from the first candidate.
-    // FIXME: Should getOutliningCandidateInfo move to TargetMachine?
-    const TargetInstrInfo *TII =
-        CandidatesForRepeatedSeq[0].getMF()->getSubtarget().getInstrInfo();
-
-    std::optional<OutlinedFunction> OF =
-        TII->getOutliningCandidateInfo(CandidatesForRepeatedSeq);
+  // We've found something we might want to outline.
+  // Create an OutlinedFunction to store it and check if it'd be beneficial
+  // to outline.
+  if (CandidatesForRepeatedSeq.size() < 2)
+    return;
+
+  // Arbitrarily choose a TII from the first candidate.
+  // FIXME: Should getOutliningCandidateInfo move to TargetMachine?
+  const TargetInstrInfo *TII =
+      CandidatesForRepeatedSeq[0].getMF()->getSubtarget().getInstrInfo();
+
+  std::optional<OutlinedFunction> OF =
+      TII->getOutliningCandidateInfo(CandidatesForRepeatedSeq);
+
+  // If we deleted too many candidates, then there's nothing worth outlining.
+  // FIXME: This should take target-specified instruction sizes into account.
+  if (!OF || OF->Candidates.size() < 2)
+    return;
+
+  // Is it better to outline this candidate than not?
+  if (OF->getBenefit() < OutlinerBenefitThreshold) {
+    emitNotOutliningCheaperRemark(StringLen, CandidatesForRepeatedSeq, *OF);
+    return;
+  }
 
-    // If we deleted too many candidates, then there's nothing worth outlining.
-    // FIXME: This should take target-specified instruction sizes into account.
-    if (!OF || OF->Candidates.size() < 2)
-      continue;
+  FunctionList.push_back(*OF);
+}
 
-    // Is it better to outline this candidate than not?
-    if (OF->getBenefit() < OutlinerBenefitThreshold) {
-      emitNotOutliningCheaperRemark(StringLen, CandidatesForRepeatedSeq, *OF);
-      continue;
-    }
+void MachineOutliner::findCandidates(
+    InstructionMapper &Mapper, std::vector<OutlinedFunction> &FunctionList) {
+  FunctionList.clear();
 
-    FunctionList.push_back(*OF);
+  // First, find all of the repeated substrings in the tree of minimum length
+  // 2.
+  std::vector<Candidate> CandidatesForRepeatedSeq;
+  LLVM_DEBUG(dbgs() << "*** Discarding overlapping candidates *** \n");
+  LLVM_DEBUG(
+      dbgs() << "Searching for overlaps in all repeated sequences...\n");
+  if (OutlinerUseSuffixArray) {
+    SuffixArray SA(Mapper.UnsignedVec);
+    for (const SuffixTree::RepeatedSubstring &RS : SA)
+      findCandidatesForRepeatedSubstring(Mapper, RS, CandidatesForRepeatedSeq,
+                                         FunctionList);
+    return;
   }
+  SuffixTree ST(Mapper.UnsignedVec);
+  for (const SuffixTree::RepeatedSubstring &RS : ST)
+    findCandidatesForRepeatedSubstring(Mapper, RS, CandidatesForRepeatedSeq,
+                                       FunctionList);
 }
 
 MachineFunction *MachineOutliner::createOutlinedFunction(
@@ -127,6 +127,14 @@ static cl::opt<unsigned long> GrowRegionComplexityBudget(
              "limit its budget and bail out once we reach the limit."),
     cl::init(10000), cl::Hidden);
 
+static cl::opt<unsigned> RegionSplitBudget(
+    "greedy-region-split-budget",
+    cl::desc("Region splitting is the most expensive split strategy and can "
+             "dominate compile time on huge functions. Once a function has "
+             "tried this many region splits, fall back to block splitting "
+             "(0 = unlimited)."),
+    cl::init(0), cl::Hidden);
+
 static cl::opt<bool> GreedyRegClassPriorityTrumpsGlobalness(
     "greedy-regclass-priority-trumps-globalness",
     cl::desc("Change the greedy register allocator's live range priority "
@@ -1824,9 +1832,23 @@ unsigned RAGreedy::trySplit(const LiveInterval &VirtReg, AllocationOrder &Order,
   // ranges already made dubious progress with region splitting, so they go
   // straight to single block splitting.
   if (ExtraInfo->getStage(VirtReg) < RS_Split2) {
-    MCRegister PhysReg = tryRegionSplit(VirtReg, Order, NewVRegs);
-    if (PhysReg || !NewVRegs.empty())
-      return PhysReg;
+    if (!RegionSplitBudget || NumRegionSplitAttempts < RegionSplitBudget) {
+      ++NumRegionSplitAttempts;
+      MCRegister PhysReg = tryRegionSplit(VirtReg, Order, NewVRegs);
+      if (PhysReg || !NewVRegs.empty())
+        return PhysReg;
+    } else if (NumRegionSplitAttempts == RegionSplitBudget) {
+      ++NumRegionSplitAttempts; // Only report once per function.
+      ORE->emit([&]() {
+        return MachineOptimizationRemarkAnalysis(
+                   DEBUG_TYPE, "RegionSplitBudget",
+                   MF->getFunction().getSubprogram(), &MF->front())
+               << "region split budget of "
+               << ore::NV("Budget", RegionSplitBudget.getValue())
+               << " exhausted; using block splitting for the remaining "
+                  "live ranges";
+      });
+    }
   }
 
   // Then isolate blocks.
@@ -2767,6 +2789,7 @@ bool RAGreedy::runOnMachineFunction(MachineFunction &mf) {
   IntfCache.init(MF, Matrix->getLiveUnions(), Indexes, LIS, TRI);
   GlobalCand.resize(32);  // This will grow as needed.
   SetOfBrokenHints.clear();
+  NumRegionSplitAttempts = 0;
 
   allocatePhysRegs();
   tryHintsRecoloring();
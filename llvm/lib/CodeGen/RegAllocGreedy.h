@@ -280,6 +280,10 @@ private:
 
   bool ReverseLocalAssignment = false;
 
+  /// Number of region splits tried in this function, for
+  /// -greedy-region-split-budget.
+  unsigned NumRegionSplitAttempts = 0;
+
 public:
   RAGreedy(const RegClassFilterFunc F = allocateAllRegClasses);
 
@@ -127,10 +127,10 @@ ScheduleDAGInstrs::ScheduleDAGInstrs(MachineFunction &mf,
 /// tracked to a normal reference to a known object, return the Value
 /// for that object. This function returns false the memory location is
 /// unknown or may alias anything.
-static bool getUnderlyingObjectsForInstr(const MachineInstr *MI,
-                                         const MachineFrameInfo &MFI,
-                                         UnderlyingObjectsVector &Objects,
-                                         const DataLayout &DL) {
+static bool getUnderlyingObjectsForInstr(
+    const MachineInstr *MI, const MachineFrameInfo &MFI,
+    UnderlyingObjectsVector &Objects, const DataLayout &DL,
+    DenseMap<const Value *, SmallVector<Value *, 4>> &Cache) {
   auto AllMMOsOkay = [&]() {
     for (const MachineMemOperand *MMO : MI->memoperands()) {
       // TODO: Figure out whether isAtomic is really necessary (see D57601).
@@ -155,11 +155,13 @@ static bool getUnderlyingObjectsForInstr(const MachineInstr *MI,
         bool MayAlias = PSV->mayAlias(&MFI);
         Objects.emplace_back(PSV, MayAlias);
       } else if (const Value *V = MMO->getValue()) {
-        SmallVector<Value *, 4> Objs;
-        if (!getUnderlyingObjectsForCodeGen(V, Objs))
+        auto [It, Inserted] = Cache.try_emplace(V);
+        if (Inserted)
+          getUnderlyingObjectsForCodeGen(V, It->second);
+        if (It->second.empty())
           return false;
 
-        for (Value *V : Objs) {
+        for (Value *V : It->second) {
           assert(isIdentifiedObject(V));
           Objects.emplace_back(V, true);
         }
@@ -947,8 +949,8 @@ void ScheduleDAGInstrs::buildSchedGraph(AAResults *AA,
     // empty, or filled with the Values of memory locations which this
     // SU depends on.
     UnderlyingObjectsVector Objs;
-    bool ObjsFound = getUnderlyingObjectsForInstr(&MI, MFI, Objs,
-                                                  MF.getDataLayout());
+    bool ObjsFound = getUnderlyingObjectsForInstr(
+        &MI, MFI, Objs, MF.getDataLayout(), UnderlyingObjectsCache);
 
     if (MI.mayStore()) {
       if (!ObjsFound) {
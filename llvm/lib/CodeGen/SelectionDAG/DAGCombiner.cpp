@@ -27,6 +27,7 @@
 #include "llvm/ADT/SmallSet.h"
 #include "llvm/ADT/SmallVector.h"
 #include "llvm/ADT/Statistic.h"
+#include "llvm/ADT/StringMap.h"
 #include "llvm/Analysis/AliasAnalysis.h"
 #include "llvm/Analysis/MemoryLocation.h"
 #include "llvm/Analysis/TargetLibraryInfo.h"
@@ -62,7 +63,10 @@
 #include "llvm/Support/DebugCounter.h"
 #include "llvm/Support/ErrorHandling.h"
 #include "llvm/Support/KnownBits.h"
+#include "llvm/Support/ManagedStatic.h"
 #include "llvm/Support/MathExtras.h"
+#include "llvm/Support/Mutex.h"
+#include "llvm/Support/Timer.h"
 #include "llvm/Support/raw_ostream.h"
 #include "llvm/Target/TargetMachine.h"
 #include "llvm/Target/TargetOptions.h"
@@ -91,6 +95,8 @@ STATISTIC(OpsNarrowed     , "Number of load/op/store narrowed");
 STATISTIC(LdStFP2Int      , "Number of fp load/store pairs transformed to int");
 STATISTIC(SlicedLoads, "Number of load sliced");
 STATISTIC(NumFPLogicOpsConv, "Number of logic ops converted to fp ops");
+STATISTIC(NumSkippedUnchanged,
+          "Number of worklist entries skipped because they were unchanged");
 
 DEBUG_COUNTER(DAGCombineCounter, "dagcombine",
               "Controls whether a DAG combine is performed for a node");
@@ -150,6 +156,65 @@ static cl::opt<bool> EnableVectorFCopySignExtendRound(
     cl::desc(
         "Enable merging extends and rounds into FCOPYSIGN on vector types"));
 
+static cl::opt<bool> ProfileCombines(
+    "combiner-profile", cl::Hidden, cl::init(false),
+    cl::desc("Report the time spent combining each opcode, with the number "
+             "of visits and successful combines, when the program exits"));
+
+/// Revisiting a node whose operands are unchanged can still find a combine,
+/// since the patterns look further up the DAG and at use counts, so this is
+/// off by default. It is meant for finding combines that are retried
+/// pathologically often.
+static cl::opt<bool> SkipUnchangedNodes(
+    "combiner-skip-unchanged-nodes", cl::Hidden, cl::init(false),
+    cl::desc("Do not revisit a node that failed to combine until its "
+             "opcode, operands or their single-use status change"));
+
+namespace {
+
+/// Time and counts for the combines of one opcode, collected under
+/// -combiner-profile.
+struct CombineProfileEntry {
+  std::string Name;
+  uint64_t Visits = 0;
+  uint64_t Combined = 0;
+  TimeRecord Time;
+};
+
+/// The -combiner-profile totals over every DAG combined, printed in the
+/// -time-passes format when LLVM shuts down.
+class CombineProfile {
+  sys::SmartMutex<true> Lock;
+  StringMap<CombineProfileEntry> Entries;
+
+public:
+  void add(const DenseMap<unsigned, CombineProfileEntry> &DAGEntries) {
+    sys::SmartScopedLock<true> L(Lock);
+    for (const auto &[Opcode, DAGEntry] : DAGEntries) {
+      CombineProfileEntry &Entry = Entries[DAGEntry.Name];
+      Entry.Visits += DAGEntry.Visits;
+      Entry.Combined += DAGEntry.Combined;
+      Entry.Time += DAGEntry.Time;
+    }
+  }
+
+  ~CombineProfile() {
+    if (Entries.empty())
+      return;
+    StringMap<TimeRecord> Records;
+    for (const auto &[Name, Entry] : Entries)
+      Records[(Name + " (" + Twine(Entry.Combined) + " of " +
+               Twine(Entry.Visits) + " visits combined)")
+                  .str()] = Entry.Time;
+    TimerGroup("dagcombine", "DAG Combiner Profile", Records)
+        .print(*CreateInfoOutputFile());
+  }
+};
+
+} // end anonymous namespace
+
+static ManagedStatic<CombineProfile> GlobalCombineProfile;
+
 namespace {
 
   class DAGCombiner {
@@ -199,6 +264,13 @@ namespace {
     /// candidate again.
     DenseMap<SDNode *, std::pair<SDNode *, unsigned>> StoreRootCountMap;
 
+    /// Fingerprints of the nodes that last failed to combine, used by
+    /// -combiner-skip-unchanged-nodes.
+    DenseMap<SDNode *, hash_code> FailedCombineFingerprints;
+
+    /// The per-opcode profile of this DAG under -combiner-profile.
+    DenseMap<unsigned, CombineProfileEntry> Profile;
+
     // AA - Used for DAG load/store alias analysis.
     AliasAnalysis *AA;
 
@@ -294,6 +366,7 @@ namespace {
       CombinedNodes.erase(N);
       PruningList.remove(N);
       StoreRootCountMap.erase(N);
+      FailedCombineFingerprints.erase(N);
 
       auto It = WorklistMap.find(N);
       if (It == WorklistMap.end())
@@ -408,6 +481,9 @@ namespace {
     /// target-specific DAG combines.
     SDValue combine(SDNode *N);
 
+    /// Call combine and add its time and result to the profile.
+    SDValue combineAndProfile(SDNode *N);
+
     // Visitation implementation - Implement dag node combining for different
     // node types.  The semantics are as follows:
     // Return Value:
@@ -1685,6 +1761,17 @@ bool DAGCombiner::recursivelyDeleteUnusedNodes(SDNode *N) {
 //  Main DAG Combiner implementation
 //===----------------------------------------------------------------------===//
 
+/// \returns a hash of what most combines of \p N depend on: its opcode, its
+/// operands, and whether it and its operands have a single use.
+static hash_code getCombineFingerprint(const SDNode *N) {
+  hash_code Hash =
+      hash_combine(N->getOpcode(), N->use_empty(), N->hasOneUse());
+  for (const SDValue &Op : N->op_values())
+    Hash = hash_combine(Hash, Op.getNode(), Op.getResNo(),
+                        Op.getNode()->hasOneUse());
+  return Hash;
+}
+
 void DAGCombiner::Run(CombineLevel AtLevel) {
   // set the instance variables, so that the various visit routines may use it.
   Level = AtLevel;
@@ -1740,11 +1827,26 @@ void DAGCombiner::Run(CombineLevel AtLevel) {
       if (!CombinedNodes.count(ChildN.getNode()))
         AddToWorklist(ChildN.getNode());
 
+    // Combines mostly look at the operands of a node and whether they have
+    // other uses, so a node whose fingerprint is the same as when it last
+    // failed is unlikely to combine now.
+    if (SkipUnchangedNodes) {
+      auto It = FailedCombineFingerprints.find(N);
+      if (It != FailedCombineFingerprints.end() &&
+          It->second == getCombineFingerprint(N)) {
+        ++NumSkippedUnchanged;
+        continue;
+      }
+    }
+
     CombinedNodes.insert(N);
-    SDValue RV = combine(N);
+    SDValue RV = ProfileCombines ? combineAndProfile(N) : combine(N);
 
-    if (!RV.getNode())
+    if (!RV.getNode()) {
+      if (SkipUnchangedNodes)
+        FailedCombineFingerprints[N] = getCombineFingerprint(N);
       continue;
+    }
 
     ++NodesCombined;
 
@@ -1787,6 +1889,11 @@ void DAGCombiner::Run(CombineLevel AtLevel) {
   // If the root changed (e.g. it was a dead load, update the root).
   DAG.setRoot(Dummy.getValue());
   DAG.RemoveDeadNodes();
+
+  if (ProfileCombines) {
+    GlobalCombineProfile->add(Profile);
+    Profile.clear();
+  }
 }
 
 SDValue DAGCombiner::visit(SDNode *N) {
@@ -2024,6 +2131,25 @@ SDValue DAGCombiner::combine(SDNode *N) {
   return RV;
 }
 
+SDValue DAGCombiner::combineAndProfile(SDNode *N) {
+  unsigned Opcode = N->getOpcode();
+  auto [It, Inserted] = Profile.try_emplace(Opcode);
+  if (Inserted)
+    It->second.Name = N->getOperationName(&DAG);
+
+  TimeRecord Start = TimeRecord::getCurrentTime(/*Start=*/true);
+  SDValue RV = combine(N);
+  TimeRecord Elapsed = TimeRecord::getCurrentTime(/*Start=*/false);
+  Elapsed -= Start;
+
+  CombineProfileEntry &Entry = Profile[Opcode];
+  Entry.Time += Elapsed;
+  ++Entry.Visits;
+  if (RV.getNode())
+    ++Entry.Combined;
+  return RV;
+}
+
 /// Given a node, return its input chain if it has one, otherwise return a null
 /// sd operand.
 static SDValue getInputChainForNode(SDNode *N) {
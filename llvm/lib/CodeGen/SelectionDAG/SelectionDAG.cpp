@@ -1360,8 +1360,15 @@ bool SelectionDAG::shouldOptForSize() const {
 void SelectionDAG::allnodes_clear() {
   assert(&*AllNodes.begin() == &EntryNode);
   AllNodes.remove(AllNodes.begin());
-  while (!AllNodes.empty())
-    DeallocateNode(&AllNodes.front());
+  // Both callers drop the operand lists, the debug info and the extra info
+  // wholesale right after this, so only hand the node memory back to the
+  // recycler rather than calling DeallocateNode on every node.
+  while (!AllNodes.empty()) {
+    SDNode *N = AllNodes.remove(AllNodes.begin());
+    NodeAllocator.Deallocate(N);
+    __asan_unpoison_memory_region(&N->NodeType, sizeof(N->NodeType));
+    N->NodeType = ISD::DELETED_NODE;
+  }
 #ifndef NDEBUG
   NextPersistentId = 0;
 #endif
@@ -3480,6 +3480,9 @@ void SelectionDAGISel::SelectCodeCommon(SDNode *NodeToMatch,
     }
 
     case OPC_SwitchOpcode: {
+      // Nested opcode switches are scanned linearly. The top-level switch is
+      // the only one that sees every node, which is why only it gets the
+      // OpcodeOffset table above; the nested ones are short by comparison.
       unsigned CurNodeOpcode = N.getOpcode();
       unsigned SwitchStart = MatcherIndex-1; (void)SwitchStart;
       unsigned CaseSize;
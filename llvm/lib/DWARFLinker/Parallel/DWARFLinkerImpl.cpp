@@ -180,7 +180,11 @@ Error DWARFLinkerImpl::link() {
     llvm::parallel::strategy =
         hardware_concurrency(GlobalData.getOptions().Threads);
 
-  // Link object files.
+  // Link object files. The input DWARF of each object file is unloaded as
+  // soon as it is linked, but the cloned output sections of every unit are
+  // kept until all units are done, because type units and cross-unit
+  // references can only be patched then. Peak memory therefore grows with
+  // the size of the output debug info, not with the size of the inputs.
   if (GlobalData.getOptions().Threads == 1) {
     for (std::unique_ptr<LinkContext> &Context : ObjectContexts) {
       // Link object file.
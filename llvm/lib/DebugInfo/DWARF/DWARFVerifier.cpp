@@ -525,6 +525,10 @@ bool DWARFVerifier::handleDebugTUIndex() {
                      DCtx.getDWARFObj().getTUIndexSection()) == 0;
 }
 
+// Units are verified one at a time. Verifying them in parallel would need
+// per-unit diagnostic buffers to keep the output deterministic, and the
+// cross-unit reference check in verifyUnits relies on CrossUnitReferences
+// being filled in by every unit first.
 bool DWARFVerifier::handleDebugInfo() {
   const DWARFObject &DObj = DCtx.getDWARFObj();
   unsigned NumErrors = 0;
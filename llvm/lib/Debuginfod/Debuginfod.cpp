@@ -159,6 +159,16 @@ Expected<std::string> getCachedOrDownloadDebuginfo(BuildIDRef ID) {
   return getCachedOrDownloadArtifact(getDebuginfodCacheKey(UrlPath), UrlPath);
 }
 
+void prefetchDebuginfo(ArrayRef<object::BuildID> IDs,
+                       ThreadPoolInterface &Pool) {
+  ThreadPoolTaskGroup Group(Pool);
+  for (const object::BuildID &ID : IDs)
+    Group.async([&ID] {
+      consumeError(getCachedOrDownloadDebuginfo(ID).takeError());
+    });
+  Group.wait();
+}
+
 // General fetching function.
 Expected<std::string> getCachedOrDownloadArtifact(StringRef UniqueKey,
                                                   StringRef UrlPath) {
@@ -129,6 +129,12 @@ private:
     return static_cast<const LinkerImpl &>(*this);
   }
 
+  // Fixups are applied block by block on the linking thread. Blocks are
+  // independent once addresses are assigned, but the fixups of no-alloc
+  // sections allocate from the graph's allocator, and the backend applyFixup
+  // implementations are not required to be thread safe, so this stays serial.
+  // Large static archives are better served by loading only the members that
+  // are needed, as StaticLibraryDefinitionGenerator does.
   Error fixUpBlocks(LinkGraph &G) const override {
     LLVM_DEBUG(dbgs() << "Fixing up blocks:\n");
 
@@ -238,6 +238,8 @@ BasicBlock::~BasicBlock() {
 }
 
 void BasicBlock::setParent(Function *parent) {
+  if (Parent != parent)
+    Number = parent ? parent->NextBlockNum++ : -1u;
   // Set Parent=parent, updating instruction symtab entries as appropriate.
   InstList.setSymTabObject(&Parent, parent);
 }
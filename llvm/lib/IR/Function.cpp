@@ -421,6 +421,13 @@ Function::iterator Function::erase(Function::iterator FromIt,
   return BasicBlocks.erase(FromIt, ToIt);
 }
 
+void Function::renumberBlocks() {
+  NextBlockNum = 0;
+  for (BasicBlock &BB : *this)
+    BB.Number = NextBlockNum++;
+  ++BlockNumEpoch;
+}
+
 //===----------------------------------------------------------------------===//
 // Function Implementation
 //===----------------------------------------------------------------------===//
@@ -41,6 +41,7 @@
 #include "llvm/Support/ManagedStatic.h"
 #include "llvm/Support/MemoryBuffer.h"
 #include "llvm/Support/Path.h"
+#include "llvm/Support/Program.h"
 #include "llvm/Support/SHA1.h"
 #include "llvm/Support/SourceMgr.h"
 #include "llvm/Support/ThreadPool.h"
@@ -56,6 +57,7 @@
 #include "llvm/Transforms/Utils/FunctionImportUtils.h"
 #include "llvm/Transforms/Utils/SplitModule.h"
 
+#include <condition_variable>
 #include <optional>
 #include <set>
 
@@ -1411,6 +1413,7 @@ public:
 
 namespace {
 class InProcessThinBackend : public ThinBackendProc {
+protected:
   DefaultThreadPool BackendThreadPool;
   AddStreamFn AddStream;
   FileCache Cache;
@@ -1420,6 +1423,11 @@ class InProcessThinBackend : public ThinBackendProc {
   std::optional<Error> Err;
   std::mutex ErrMu;
 
+  /// Estimated memory of the running jobs, for Conf.ThinLTOMemoryBudget.
+  uint64_t MemoryInUse = 0;
+  std::mutex MemoryMu;
+  std::condition_variable MemoryCV;
+
   bool ShouldEmitIndexFiles;
 
 public:
@@ -1441,6 +1449,71 @@ public:
           GlobalValue::getGUID(GlobalValue::dropLLVMManglingEscape(Name)));
   }
 
+  /// Run the optimization and code generation pipeline for \p BM, writing
+  /// the object file to \p AddStream. Subclasses may run it elsewhere.
+  virtual Error runBackend(AddStreamFn AddStream, unsigned Task,
+                           BitcodeModule BM, ModuleSummaryIndex &CombinedIndex,
+                           const FunctionImporter::ImportMapTy &ImportList,
+                           const GVSummaryMapTy &DefinedGlobals,
+                           MapVector<StringRef, BitcodeModule> &ModuleMap) {
+    LTOLLVMContext BackendContext(Conf);
+    Expected<std::unique_ptr<Module>> MOrErr = BM.parseModule(BackendContext);
+    if (!MOrErr)
+      return MOrErr.takeError();
+
+    return thinBackend(Conf, Task, AddStream, **MOrErr, CombinedIndex,
+                       ImportList, DefinedGlobals, &ModuleMap);
+  }
+
+  /// Estimate the peak memory of the backend job for \p BM from the size of
+  /// its bitcode and the number of instructions it defines and imports. This
+  /// is deliberately crude; it only needs to tell huge jobs from small ones.
+  uint64_t estimateJobMemory(BitcodeModule BM,
+                             const FunctionImporter::ImportMapTy &ImportList,
+                             const GVSummaryMapTy &DefinedGlobals) {
+    // Rough bytes of peak memory per byte of bitcode and per IR instruction.
+    // Metadata heavy modules are accounted for by the first, code heavy ones
+    // by the second.
+    constexpr uint64_t BytesPerBitcodeByte = 8;
+    constexpr uint64_t BytesPerInstruction = 1024;
+
+    auto GetInstCount = [](const GlobalValueSummary *S) -> uint64_t {
+      if (auto *FS = dyn_cast_or_null<FunctionSummary>(
+              S ? S->getBaseObject() : nullptr))
+        return FS->instCount();
+      return 0;
+    };
+
+    uint64_t NumInsts = 0;
+    for (const auto &[GUID, S] : DefinedGlobals)
+      NumInsts += GetInstCount(S);
+    for (const auto &[FromModule, GUIDs] : ImportList)
+      for (GlobalValue::GUID GUID : GUIDs)
+        NumInsts +=
+            GetInstCount(CombinedIndex.findSummaryInModule(GUID, FromModule));
+    return BM.getBuffer().size() * BytesPerBitcodeByte +
+           NumInsts * BytesPerInstruction;
+  }
+
+  /// Block until a job estimated to need \p Estimate bytes fits within the
+  /// memory budget, then account for it.
+  void acquireMemory(uint64_t Estimate) {
+    std::unique_lock<std::mutex> L(MemoryMu);
+    MemoryCV.wait(L, [&] {
+      return MemoryInUse == 0 ||
+             MemoryInUse + Estimate <= Conf.ThinLTOMemoryBudget;
+    });
+    MemoryInUse += Estimate;
+  }
+
+  void releaseMemory(uint64_t Estimate) {
+    {
+      std::lock_guard<std::mutex> L(MemoryMu);
+      MemoryInUse -= Estimate;
+    }
+    MemoryCV.notify_all();
+  }
+
   Error runThinLTOBackendThread(
       AddStreamFn AddStream, FileCache Cache, unsigned Task, BitcodeModule BM,
       ModuleSummaryIndex &CombinedIndex,
@@ -1450,13 +1523,8 @@ public:
       const GVSummaryMapTy &DefinedGlobals,
       MapVector<StringRef, BitcodeModule> &ModuleMap) {
     auto RunThinBackend = [&](AddStreamFn AddStream) {
-      LTOLLVMContext BackendContext(Conf);
-      Expected<std::unique_ptr<Module>> MOrErr = BM.parseModule(BackendContext);
-      if (!MOrErr)
-        return MOrErr.takeError();
-
-      return thinBackend(Conf, Task, AddStream, **MOrErr, CombinedIndex,
-                         ImportList, DefinedGlobals, &ModuleMap);
+      return runBackend(AddStream, Task, BM, CombinedIndex, ImportList,
+                        DefinedGlobals, ModuleMap);
     };
 
     auto ModuleID = BM.getModuleIdentifier();
@@ -1498,6 +1566,13 @@ public:
     assert(ModuleToDefinedGVSummaries.count(ModulePath));
     const GVSummaryMapTy &DefinedGlobals =
         ModuleToDefinedGVSummaries.find(ModulePath)->second;
+    // With a memory budget, a job waits on its pool thread until enough of
+    // the running ones have finished. Without threads the jobs run one at a
+    // time anyway, and only once the caller waits on the pool, so waiting
+    // for another job to finish would never return.
+    uint64_t MemoryEstimate = 0;
+    if (LLVM_ENABLE_THREADS && Conf.ThinLTOMemoryBudget)
+      MemoryEstimate = estimateJobMemory(BM, ImportList, DefinedGlobals);
     BackendThreadPool.async(
         [=](BitcodeModule BM, ModuleSummaryIndex &CombinedIndex,
             const FunctionImporter::ImportMapTy &ImportList,
@@ -1506,6 +1581,8 @@ public:
                 &ResolvedODR,
             const GVSummaryMapTy &DefinedGlobals,
             MapVector<StringRef, BitcodeModule> &ModuleMap) {
+          if (MemoryEstimate)
+            acquireMemory(MemoryEstimate);
           if (LLVM_ENABLE_THREADS && Conf.TimeTraceEnabled)
             timeTraceProfilerInitialize(Conf.TimeTraceGranularity,
                                         "thin backend");
@@ -1519,6 +1596,8 @@ public:
             else
               Err = std::move(E);
           }
+          if (MemoryEstimate)
+            releaseMemory(MemoryEstimate);
           if (LLVM_ENABLE_THREADS && Conf.TimeTraceEnabled)
             timeTraceProfilerFinishThread();
         },
@@ -1542,8 +1621,164 @@ public:
     return BackendThreadPool.getMaxConcurrency();
   }
 };
+
+/// A warning that a remote ThinLTO job failed and is run in-process instead.
+class RemoteJobDiagnosticInfo : public DiagnosticInfo {
+  const Twine &Msg;
+
+public:
+  RemoteJobDiagnosticInfo(const Twine &DiagMsg)
+      : DiagnosticInfo(DK_Linker, DS_Warning), Msg(DiagMsg) {}
+  void print(DiagnosticPrinter &DP) const override { DP << Msg; }
+};
+
+/// This backend hands each ThinLTO job to an external executor, which may
+/// run it on another machine. Jobs the executor fails to complete are run
+/// in-process instead, so a flaky executor only costs time.
+class OutOfProcessThinBackend : public InProcessThinBackend {
+  std::string Executor;
+  std::vector<std::string> ExecutorArgs;
+
+public:
+  OutOfProcessThinBackend(
+      const Config &Conf, ModuleSummaryIndex &CombinedIndex,
+      ThreadPoolStrategy ThinLTOParallelism,
+      const DenseMap<StringRef, GVSummaryMapTy> &ModuleToDefinedGVSummaries,
+      AddStreamFn AddStream, FileCache Cache, lto::IndexWriteCallback OnWrite,
+      bool ShouldEmitIndexFiles, bool ShouldEmitImportsFiles,
+      std::string Executor, std::vector<std::string> ExecutorArgs)
+      : InProcessThinBackend(Conf, CombinedIndex, ThinLTOParallelism,
+                             ModuleToDefinedGVSummaries, std::move(AddStream),
+                             std::move(Cache), OnWrite, ShouldEmitIndexFiles,
+                             ShouldEmitImportsFiles),
+        Executor(std::move(Executor)), ExecutorArgs(std::move(ExecutorArgs)) {}
+
+  Error runBackend(AddStreamFn AddStream, unsigned Task, BitcodeModule BM,
+                   ModuleSummaryIndex &CombinedIndex,
+                   const FunctionImporter::ImportMapTy &ImportList,
+                   const GVSummaryMapTy &DefinedGlobals,
+                   MapVector<StringRef, BitcodeModule> &ModuleMap) override {
+    std::string Msg;
+    if (Error E = runRemotely(AddStream, Task, BM, ImportList, Msg))
+      return E;
+    if (Msg.empty())
+      return Error::success();
+
+    // This runs on a backend thread, so report through the diagnostic
+    // handler, which the linker serializes, rather than writing to errs().
+    if (Conf.DiagHandler)
+      Conf.DiagHandler(RemoteJobDiagnosticInfo(
+          "ThinLTO remote job for " + BM.getModuleIdentifier() +
+          " failed, running it locally: " + Msg));
+    return InProcessThinBackend::runBackend(AddStream, Task, BM, CombinedIndex,
+                                            ImportList, DefinedGlobals,
+                                            ModuleMap);
+  }
+
+private:
+  /// Run the job for \p BM with the executor. Returns an error only if the
+  /// output stream could not be written; if the job itself could not be run,
+  /// sets \p Msg to the reason and leaves \p AddStream untouched.
+  Error runRemotely(AddStreamFn AddStream, unsigned Task, BitcodeModule BM,
+                    const FunctionImporter::ImportMapTy &ImportList,
+                    std::string &Msg) {
+    StringRef ModuleID = BM.getModuleIdentifier();
+    SmallString<128> JobDir;
+    if (std::error_code EC =
+            sys::fs::createUniqueDirectory("thinlto-job", JobDir)) {
+      Msg = EC.message();
+      return Error::success();
+    }
+
+    // Everything the job needs goes in JobDir, so it is removed in one go.
+    auto Cleanup =
+        make_scope_exit([&] { sys::fs::remove_directories(JobDir); });
+
+    // Pass the input by path when the linker read it from a file. Modules
+    // that are archive members or were created in memory are written out.
+    std::string InputPath;
+    if (sys::fs::is_regular_file(ModuleID)) {
+      InputPath = ModuleID.str();
+    } else {
+      SmallString<128> Path(JobDir);
+      sys::path::append(Path, "input.bc");
+      InputPath = std::string(Path);
+      LTOLLVMContext Ctx(Conf);
+      Expected<std::unique_ptr<Module>> MOrErr = BM.parseModule(Ctx);
+      if (!MOrErr) {
+        Msg = toString(MOrErr.takeError());
+        return Error::success();
+      }
+      std::error_code EC;
+      raw_fd_ostream OS(InputPath, EC, sys::fs::OpenFlags::OF_None);
+      if (EC) {
+        Msg = EC.message();
+        return Error::success();
+      }
+      WriteBitcodeToFile(**MOrErr, OS);
+    }
+
+    SmallString<128> IndexBase(JobDir);
+    sys::path::append(IndexBase, "job");
+    if (Error E = emitFiles(ImportList, ModuleID, std::string(IndexBase))) {
+      Msg = toString(std::move(E));
+      return Error::success();
+    }
+    std::string IndexPath = (IndexBase + ".thinlto.bc").str();
+    SmallString<128> OutputPath(JobDir);
+    sys::path::append(OutputPath, "output.o");
+
+    SmallVector<StringRef, 8> Args;
+    Args.push_back(Executor);
+    for (const std::string &Arg : ExecutorArgs)
+      Args.push_back(Arg);
+    Args.push_back(InputPath);
+    Args.push_back(IndexPath);
+    Args.push_back(OutputPath);
+
+    std::string ErrMsg;
+    int RC = sys::ExecuteAndWait(Executor, Args, /*Env=*/std::nullopt,
+                                 /*Redirects=*/{}, /*SecondsToWait=*/0,
+                                 /*MemoryLimit=*/0, &ErrMsg);
+    if (RC != 0) {
+      Msg = ErrMsg.empty() ? "executor exited with code " + std::to_string(RC)
+                           : ErrMsg;
+      return Error::success();
+    }
+
+    ErrorOr<std::unique_ptr<MemoryBuffer>> ObjOrErr =
+        MemoryBuffer::getFile(OutputPath, /*IsText=*/false,
+                              /*RequiresNullTerminator=*/false);
+    if (!ObjOrErr) {
+      Msg = ObjOrErr.getError().message();
+      return Error::success();
+    }
+
+    Expected<std::unique_ptr<CachedFileStream>> StreamOrErr =
+        AddStream(Task, ModuleID);
+    if (!StreamOrErr)
+      return StreamOrErr.takeError();
+    *(*StreamOrErr)->OS << (*ObjOrErr)->getBuffer();
+    return Error::success();
+  }
+};
 } // end anonymous namespace
 
+ThinBackend lto::createOutOfProcessThinBackend(
+    ThreadPoolStrategy Parallelism, std::string Executor,
+    std::vector<std::string> ExecutorArgs, lto::IndexWriteCallback OnWrite,
+    bool ShouldEmitIndexFiles, bool ShouldEmitImportsFiles) {
+  return
+      [=](const Config &Conf, ModuleSummaryIndex &CombinedIndex,
+          const DenseMap<StringRef, GVSummaryMapTy> &ModuleToDefinedGVSummaries,
+          AddStreamFn AddStream, FileCache Cache) {
+        return std::make_unique<OutOfProcessThinBackend>(
+            Conf, CombinedIndex, Parallelism, ModuleToDefinedGVSummaries,
+            AddStream, Cache, OnWrite, ShouldEmitIndexFiles,
+            ShouldEmitImportsFiles, Executor, ExecutorArgs);
+      };
+}
+
 ThinBackend lto::createInProcessThinBackend(ThreadPoolStrategy Parallelism,
                                             lto::IndexWriteCallback OnWrite,
                                             bool ShouldEmitIndexFiles,
@@ -490,16 +490,20 @@ bool ModuleLinker::run() {
     ReplacedDstComdats.insert(DstC);
   }
 
-  // Alias have to go first, since we are not able to find their comdats
-  // otherwise.
-  for (GlobalAlias &GV : llvm::make_early_inc_range(DstM.aliases()))
-    dropReplacedComdat(GV, ReplacedDstComdats);
-
-  for (GlobalVariable &GV : llvm::make_early_inc_range(DstM.globals()))
-    dropReplacedComdat(GV, ReplacedDstComdats);
-
-  for (Function &GV : llvm::make_early_inc_range(DstM))
-    dropReplacedComdat(GV, ReplacedDstComdats);
+  // Walking the whole destination module for every linked module makes
+  // linking N modules quadratic, so only do it if a comdat was replaced.
+  if (!ReplacedDstComdats.empty()) {
+    // Alias have to go first, since we are not able to find their comdats
+    // otherwise.
+    for (GlobalAlias &GV : llvm::make_early_inc_range(DstM.aliases()))
+      dropReplacedComdat(GV, ReplacedDstComdats);
+
+    for (GlobalVariable &GV : llvm::make_early_inc_range(DstM.globals()))
+      dropReplacedComdat(GV, ReplacedDstComdats);
+
+    for (Function &GV : llvm::make_early_inc_range(DstM))
+      dropReplacedComdat(GV, ReplacedDstComdats);
+  }
 
   if (!NonPrevailingComdats.empty()) {
     DenseSet<GlobalObject *> AliasedGlobals;
@@ -69,6 +69,8 @@ STATISTIC(evaluateFixup, "Number of evaluated fixups");
 STATISTIC(FragmentLayouts, "Number of fragment layouts");
 STATISTIC(ObjectBytes, "Number of emitted object file bytes");
 STATISTIC(RelaxationSteps, "Number of assembler layout and relaxation steps");
+STATISTIC(SectionRelaxationSteps,
+          "Number of section layout and relaxation steps");
 STATISTIC(RelaxedInstructions, "Number of relaxed instructions");
 
 } // end namespace stats
@@ -1220,10 +1222,14 @@ bool MCAssembler::relaxFragment(MCAsmLayout &Layout, MCFragment &F) {
 }
 
 bool MCAssembler::layoutSectionOnce(MCAsmLayout &Layout, MCSection &Sec) {
+  ++stats::SectionRelaxationSteps;
+
   // Holds the first fragment which needed relaxing during this layout. It will
   // remain NULL if none were relaxed.
   // When a fragment is relaxed, all the fragments following it should get
-  // invalidated because their offset is going to change.
+  // invalidated because their offset is going to change. This is done once
+  // for the whole pass: invalidating after every relaxed fragment would lay
+  // the rest of the section out again for each of them.
   MCFragment *FirstRelaxedFragment = nullptr;
 
   // Attempt to relax all the fragments in the section.
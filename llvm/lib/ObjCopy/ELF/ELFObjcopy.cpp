@@ -31,6 +31,7 @@
 #include "llvm/Support/ErrorOr.h"
 #include "llvm/Support/FileSystem.h"
 #include "llvm/Support/Memory.h"
+#include "llvm/Support/Parallel.h"
 #include "llvm/Support/Path.h"
 #include "llvm/Support/raw_ostream.h"
 #include <algorithm>
@@ -220,6 +221,12 @@ Error Object::compressOrDecompressSections(const CommonConfig &Config) {
   // because it would mutate the sections array.
   SmallVector<std::pair<SectionBase *, std::function<SectionBase *()>>, 0>
       ToReplace;
+  // Compressing a section only reads its own data, so the sections to be
+  // compressed are collected here and compressed in parallel below. The
+  // results are then added to the object in the original section order.
+  SmallVector<std::pair<const SectionBase *, DebugCompressionType>, 0>
+      ToCompress;
+  SmallVector<std::optional<CompressedSection>, 0> Compressed;
   for (SectionBase &Sec : sections()) {
     std::optional<DebugCompressionType> CType;
     for (auto &[Matcher, T] : Config.compressSections)
@@ -247,13 +254,19 @@ Error Object::compressOrDecompressSections(const CommonConfig &Config) {
         ToReplace.emplace_back(
             &Sec, [=] { return &addSection<DecompressedSection>(*CS); });
     } else if (*CType != DebugCompressionType::None) {
-      ToReplace.emplace_back(&Sec, [=, S = &Sec] {
-        return &addSection<CompressedSection>(
-            CompressedSection(*S, *CType, Is64Bits));
+      ToReplace.emplace_back(&Sec, [=, &Compressed, I = ToCompress.size()] {
+        return &addSection<CompressedSection>(std::move(*Compressed[I]));
       });
+      ToCompress.emplace_back(&Sec, *CType);
     }
   }
 
+  Compressed.resize(ToCompress.size());
+  parallelFor(0, ToCompress.size(), [&](size_t I) {
+    Compressed[I].emplace(*ToCompress[I].first, ToCompress[I].second,
+                          Is64Bits);
+  });
+
   DenseMap<SectionBase *, SectionBase *> FromTo;
   for (auto [S, Func] : ToReplace)
     FromTo[S] = Func();
@@ -815,6 +815,11 @@ computeMemberData(raw_ostream &StringTable, raw_ostream &SymNames,
       Entry.second = Entry.second > 1 ? 1 : 0;
   }
 
+  // Members are parsed one after another. Bitcode members are read into the
+  // shared LLVMContext, which is not thread safe, and the symbol table below
+  // has to be built in member order anyway since the first definition of a
+  // name wins. Every member is parsed again each time an archive is written;
+  // nothing from a previous symbol table is reused.
   std::vector<std::unique_ptr<SymbolicFile>> SymFiles;
 
   if (NeedSymbols != SymtabWritingMode::NoSymtab || isAIXBigArchive(Kind)) {
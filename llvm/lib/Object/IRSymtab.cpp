@@ -12,6 +12,7 @@
 #include "llvm/ADT/SmallPtrSet.h"
 #include "llvm/ADT/SmallString.h"
 #include "llvm/ADT/SmallVector.h"
+#include "llvm/ADT/Statistic.h"
 #include "llvm/ADT/StringRef.h"
 #include "llvm/Bitcode/BitcodeReader.h"
 #include "llvm/Config/llvm-config.h"
@@ -41,6 +42,11 @@
 using namespace llvm;
 using namespace irsymtab;
 
+#define DEBUG_TYPE "irsymtab"
+
+STATISTIC(NumUpgradedFiles, "Number of bitcode files whose irsymtab had to be "
+                            "rebuilt by parsing their modules");
+
 static cl::opt<bool> DisableBitcodeVersionUpgrade(
     "disable-bitcode-version-upgrade", cl::Hidden,
     cl::desc("Disable automatic bitcode upgrade for version mismatch"));
@@ -379,6 +385,7 @@ Error irsymtab::build(ArrayRef<Module *> Mods, SmallVector<char, 0> &Symtab,
 // creating an irsymtab for them in the current format.
 static Expected<FileContents> upgrade(ArrayRef<BitcodeModule> BMs) {
   FileContents FC;
+  ++NumUpgradedFiles;
 
   LLVMContext Ctx;
   std::vector<Module *> Mods;
@@ -0,0 +1,116 @@
+//===- llvm/Support/Jobserver.cpp - GNU make jobserver client -------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#include "llvm/Support/Jobserver.h"
+#include "llvm/Config/llvm-config.h"
+#include "llvm/Support/Process.h"
+
+#include <optional>
+#include <string>
+
+using namespace llvm;
+
+// Returns the value of the last --jobserver-auth= option in MAKEFLAGS, or of
+// --jobserver-fds= as used by GNU make before 4.2.
+static std::optional<std::string> getJobserverAuth() {
+  std::optional<std::string> MakeFlags = sys::Process::GetEnv("MAKEFLAGS");
+  if (!MakeFlags)
+    return std::nullopt;
+  SmallVector<StringRef, 8> Flags;
+  StringRef(*MakeFlags).split(Flags, ' ', /*MaxSplit=*/-1,
+                              /*KeepEmpty=*/false);
+  std::optional<std::string> Auth;
+  for (StringRef Flag : Flags)
+    if (Flag.consume_front("--jobserver-auth=") ||
+        Flag.consume_front("--jobserver-fds="))
+      Auth = Flag.str();
+  return Auth;
+}
+
+JobserverClient *JobserverClient::getInstance() {
+  // The client is never destroyed, as tasks may still hold slots during exit.
+  static JobserverClient *Instance = []() -> JobserverClient * {
+    std::optional<std::string> Auth = getJobserverAuth();
+    if (!Auth)
+      return nullptr;
+    JobserverClient *Client = new JobserverClient();
+    if (Client->connect(*Auth))
+      return Client;
+    delete Client;
+    return nullptr;
+  }();
+  return Instance;
+}
+
+bool JobserverClient::acquire() {
+  std::unique_lock<std::mutex> Lock(Mutex);
+  while (true) {
+    if (ImplicitSlotFree) {
+      ImplicitSlotFree = false;
+      return true;
+    }
+    // Wait for a token without holding the lock. If the implicit slot is
+    // given back in the meantime, we are woken up to take it instead.
+    ++Waiters;
+    Lock.unlock();
+    char Token;
+    ReadResult Result = readToken(Token);
+    Lock.lock();
+    --Waiters;
+    if (Result == ReadResult::Token) {
+      Tokens.push_back(Token);
+      return true;
+    }
+    if (Result == ReadResult::Error)
+      return false;
+  }
+}
+
+void JobserverClient::release() {
+  std::unique_lock<std::mutex> Lock(Mutex);
+  if (Tokens.empty()) {
+    ImplicitSlotFree = true;
+    if (Waiters)
+      wake();
+    return;
+  }
+  char Token = Tokens.pop_back_val();
+  Lock.unlock();
+  writeToken(Token);
+}
+
+// Number of slots (including nested ones, which don't take a token) held by
+// the current thread.
+static thread_local unsigned SlotsHeld = 0;
+
+JobserverSlot::JobserverSlot(bool Enable) : Enabled(Enable) {
+  if (!Enabled)
+    return;
+  if (SlotsHeld++ == 0)
+    if (JobserverClient *Client = JobserverClient::getInstance())
+      Acquired = Client->acquire();
+}
+
+JobserverSlot::~JobserverSlot() {
+  if (!Enabled)
+    return;
+  --SlotsHeld;
+  if (Acquired)
+    JobserverClient::getInstance()->release();
+}
+
+#ifdef LLVM_ON_UNIX
+#include "Unix/Jobserver.inc"
+#else
+bool JobserverClient::connect(StringRef Auth) { return false; }
+JobserverClient::ReadResult JobserverClient::readToken(char &Token) {
+  return ReadResult::Error;
+}
+void JobserverClient::writeToken(char Token) {}
+void JobserverClient::wake() {}
+#endif
@@ -267,6 +267,12 @@ LockFileManager::LockFileState LockFileManager::getState() const {
   return LFS_Owned;
 }
 
+bool LockFileManager::isLocked(StringRef FileName) {
+  SmallString<128> LockFileName(FileName);
+  LockFileName += ".lock";
+  return readLockFile(LockFileName).has_value();
+}
+
 std::string LockFileManager::getErrorMessage() const {
   if (ErrorCode) {
     std::string Str(ErrorDiagMsg);
@@ -238,6 +238,8 @@ public:
   }
 
   void dontNeedIfMmap() override { MFR.dontNeed(); }
+
+  void adviseIfMmap(sys::fs::access_hint Hint) override { MFR.advise(Hint); }
 };
 } // namespace
 
@@ -8,6 +8,7 @@
 
 #include "llvm/Support/Parallel.h"
 #include "llvm/Config/llvm-config.h"
+#include "llvm/Support/Jobserver.h"
 #include "llvm/Support/ManagedStatic.h"
 #include "llvm/Support/Threading.h"
 
@@ -211,7 +212,10 @@ void TaskGroup::spawn(std::function<void()> F, bool Sequential) {
     L.inc();
     detail::Executor::getDefaultExecutor()->add(
         [&, F = std::move(F)] {
-          F();
+          {
+            JobserverSlot Slot(parallel::strategy.UseJobserver);
+            F();
+          }
           L.dec();
         },
         Sequential);
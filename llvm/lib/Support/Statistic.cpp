@@ -93,6 +93,124 @@ public:
 static ManagedStatic<StatisticInfo> StatInfo;
 static ManagedStatic<sys::SmartMutex<true> > StatLock;
 
+namespace {
+/// The counters of one thread, indexed by TrackingStatistic::CounterIndex.
+/// Counters are allocated in fixed-size chunks that never move, so that other
+/// threads can read them while the owning thread keeps adding statistics.
+/// Counters are never freed: when their thread exits, they are handed to the
+/// next thread that needs them, so their values don't have to be folded into
+/// the statistics.
+struct ThreadStatisticCounters {
+  detail::StatisticCounterChunks Chunks = {};
+  /// The next entry in the list of all counters. Immutable once published.
+  ThreadStatisticCounters *Next = nullptr;
+  /// Whether a live thread owns these counters.
+  std::atomic<bool> InUse{true};
+
+  /// Return the counter for \p Index. Must only be called by the owning
+  /// thread.
+  std::atomic<uint64_t> &get(unsigned Index) {
+    std::atomic<std::atomic<uint64_t> *> &Slot =
+        Chunks[Index / detail::StatisticCounterChunkSize];
+    std::atomic<uint64_t> *Chunk = Slot.load(std::memory_order_relaxed);
+    if (!Chunk) {
+      Chunk = new std::atomic<uint64_t>[detail::StatisticCounterChunkSize]();
+      Slot.store(Chunk, std::memory_order_release);
+    }
+    return Chunk[Index % detail::StatisticCounterChunkSize];
+  }
+
+  /// Return the counter for \p Index, or null if no owning thread has touched
+  /// its chunk yet.
+  std::atomic<uint64_t> *lookup(unsigned Index) {
+    std::atomic<uint64_t> *Chunk =
+        Chunks[Index / detail::StatisticCounterChunkSize].load(
+            std::memory_order_acquire);
+    return Chunk ? &Chunk[Index % detail::StatisticCounterChunkSize] : nullptr;
+  }
+};
+
+/// Gives the counters of the current thread back when the thread exits.
+struct ThreadStatisticCountersHolder {
+  ThreadStatisticCounters *Counters = nullptr;
+
+  ~ThreadStatisticCountersHolder();
+};
+} // end anonymous namespace
+
+/// The list of all threads' counters, which only ever grows.
+static std::atomic<ThreadStatisticCounters *> AllCounters;
+
+/// The number of counter indices handed out so far. Guarded by StatLock.
+static unsigned NumCounterIndices = 1;
+
+static thread_local ThreadStatisticCountersHolder ThreadCounters;
+#ifdef _WIN32
+static thread_local detail::StatisticCounterChunks
+    *ThreadStatisticCounterChunks;
+#else
+thread_local detail::StatisticCounterChunks
+    *llvm::detail::ThreadStatisticCounterChunks;
+using llvm::detail::ThreadStatisticCounterChunks;
+#endif
+
+ThreadStatisticCountersHolder::~ThreadStatisticCountersHolder() {
+  if (!Counters)
+    return;
+  ThreadStatisticCounterChunks = nullptr;
+  Counters->InUse.store(false, std::memory_order_release);
+  Counters = nullptr;
+}
+
+std::atomic<uint64_t> &
+llvm::detail::getThreadStatisticCounterSlow(unsigned Index) {
+  if (LLVM_UNLIKELY(!ThreadCounters.Counters)) {
+    // Take over the counters of a thread that has exited, if there is one.
+    ThreadStatisticCounters *Counters = nullptr;
+    for (ThreadStatisticCounters *C =
+             AllCounters.load(std::memory_order_acquire);
+         C && !Counters; C = C->Next) {
+      bool Expected = false;
+      if (C->InUse.compare_exchange_strong(Expected, true,
+                                           std::memory_order_acquire))
+        Counters = C;
+    }
+    if (!Counters) {
+      Counters = new ThreadStatisticCounters;
+      Counters->Next = AllCounters.load(std::memory_order_relaxed);
+      while (!AllCounters.compare_exchange_weak(Counters->Next, Counters,
+                                                std::memory_order_release,
+                                                std::memory_order_relaxed)) {
+      }
+    }
+    ThreadCounters.Counters = Counters;
+    ThreadStatisticCounterChunks = &Counters->Chunks;
+  }
+  return ThreadCounters.Counters->get(Index);
+}
+
+#ifdef _WIN32
+std::atomic<uint64_t> &llvm::detail::getThreadStatisticCounter(unsigned Index) {
+  return getThreadStatisticCounterSlow(Index);
+}
+#endif
+
+uint64_t llvm::detail::sumStatisticCounters(unsigned Index) {
+  uint64_t Sum = 0;
+  for (ThreadStatisticCounters *C = AllCounters.load(std::memory_order_acquire);
+       C; C = C->Next)
+    if (std::atomic<uint64_t> *Counter = C->lookup(Index))
+      Sum += Counter->load(std::memory_order_relaxed);
+  return Sum;
+}
+
+void llvm::detail::resetStatisticCounters(unsigned Index) {
+  for (ThreadStatisticCounters *C = AllCounters.load(std::memory_order_acquire);
+       C; C = C->Next)
+    if (std::atomic<uint64_t> *Counter = C->lookup(Index))
+      Counter->store(0, std::memory_order_relaxed);
+}
+
 /// RegisterStatistic - The first time a statistic is bumped, this method is
 /// called.
 void TrackingStatistic::RegisterStatistic() {
@@ -114,6 +232,13 @@ void TrackingStatistic::RegisterStatistic() {
     if (EnableStats || Enabled)
       SI.addStatistic(this);
 
+    // Give the statistic a slot in the per-thread counter tables. Statistics
+    // registered after the tables are full keep updating Value atomically.
+    if (!CounterIndex.load(std::memory_order_relaxed) &&
+        NumCounterIndices < detail::StatisticCounterChunkSize *
+                                detail::MaxStatisticCounterChunks)
+      CounterIndex.store(NumCounterIndices++, std::memory_order_release);
+
     // Remember we have been registered.
     Initialized.store(true, std::memory_order_release);
   }
@@ -162,6 +287,8 @@ void StatisticInfo::reset() {
     // Value updates to a statistic that complete before this statement in the
     // iteration for that statistic will be lost as intended.
     Stat->Initialized = false;
+    if (unsigned Index = Stat->CounterIndex.load(std::memory_order_relaxed))
+      detail::resetStatisticCounters(Index);
     Stat->Value = 0;
   }
 
@@ -0,0 +1,131 @@
+//===- llvm/Support/SuffixArray.cpp - Implement Suffix Array ----*- C++ -*-===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// This file implements the SuffixArray class.
+//
+//===----------------------------------------------------------------------===//
+
+#include "llvm/Support/SuffixArray.h"
+#include "llvm/ADT/SmallVector.h"
+#include "llvm/Support/Parallel.h"
+
+using namespace llvm;
+
+/// Sort the suffixes of \p Str into \p SA using prefix doubling. On return
+/// \p Rank is the inverse of \p SA.
+static void buildSuffixArray(ArrayRef<unsigned> Str,
+                             std::vector<unsigned> &SA,
+                             std::vector<unsigned> &Rank) {
+  size_t N = Str.size();
+  SA.resize(N);
+  Rank.resize(N);
+  for (size_t I = 0; I < N; ++I)
+    SA[I] = I;
+  if (N == 0)
+    return;
+
+  // Rank the suffixes by their first element. The elements are arbitrary
+  // integers, so compress them into [0, N) first.
+  parallelSort(SA, [&](unsigned A, unsigned B) { return Str[A] < Str[B]; });
+  unsigned NumRanks = 1;
+  Rank[SA[0]] = 0;
+  for (size_t I = 1; I < N; ++I) {
+    if (Str[SA[I]] != Str[SA[I - 1]])
+      ++NumRanks;
+    Rank[SA[I]] = NumRanks - 1;
+  }
+
+  // Each round sorts the suffixes by their first 2 * K elements, using the
+  // ranks of the first K elements at I and at I + K. A suffix which ends
+  // before I + K sorts before every suffix which continues past it.
+  std::vector<unsigned> NewRank(N);
+  for (size_t K = 1; NumRanks < N; K *= 2) {
+    auto SecondKey = [&](unsigned I) -> unsigned {
+      return I + K < N ? Rank[I + K] + 1 : 0;
+    };
+    auto Less = [&](unsigned A, unsigned B) {
+      if (Rank[A] != Rank[B])
+        return Rank[A] < Rank[B];
+      return SecondKey(A) < SecondKey(B);
+    };
+    parallelSort(SA, Less);
+    NumRanks = 1;
+    NewRank[SA[0]] = 0;
+    for (size_t I = 1; I < N; ++I) {
+      if (Less(SA[I - 1], SA[I]))
+        ++NumRanks;
+      NewRank[SA[I]] = NumRanks - 1;
+    }
+    Rank.swap(NewRank);
+  }
+}
+
+/// \returns the LCP table of \p SA: entry I is the length of the longest
+/// common prefix of the suffixes at SA[I - 1] and SA[I], and entry 0 is 0.
+///
+/// This is Kasai's algorithm, and it reuses the storage of \p Rank.
+static std::vector<unsigned> buildLCP(ArrayRef<unsigned> Str,
+                                      ArrayRef<unsigned> SA,
+                                      std::vector<unsigned> &&Rank) {
+  size_t N = Str.size();
+  std::vector<unsigned> LCP(N, 0);
+  unsigned H = 0;
+  for (size_t I = 0; I < N; ++I) {
+    unsigned R = Rank[I];
+    if (R == 0) {
+      H = 0;
+      continue;
+    }
+    unsigned J = SA[R - 1];
+    while (I + H < N && J + H < N && Str[I + H] == Str[J + H])
+      ++H;
+    LCP[R] = H;
+    if (H > 0)
+      --H;
+  }
+  return LCP;
+}
+
+SuffixArray::SuffixArray(ArrayRef<unsigned> Str) {
+  std::vector<unsigned> SA, Rank;
+  buildSuffixArray(Str, SA, Rank);
+  std::vector<unsigned> LCP = buildLCP(Str, SA, std::move(Rank));
+
+  // Walk the LCP intervals bottom up. Each interval is a node of the suffix
+  // tree, and the intervals still open form the path from the root to the
+  // current suffix. A suffix is a leaf child of the interval whose length is
+  // the larger of the LCPs with its two neighbours.
+  struct Interval {
+    unsigned Length;
+    SmallVector<unsigned> Leaves;
+  };
+  SmallVector<Interval> Open;
+  Open.push_back({0, {}});
+
+  // Pop every interval longer than \p Length and report the ones which
+  // repeat, then make sure an interval of exactly \p Length is open.
+  auto CloseIntervals = [&](unsigned Length) {
+    while (Open.back().Length > Length) {
+      Interval &I = Open.back();
+      if (I.Length >= MinLength && I.Leaves.size() >= 2)
+        RepeatedSubstrings.push_back({I.Length, std::move(I.Leaves)});
+      Open.pop_back();
+    }
+    if (Open.back().Length < Length)
+      Open.push_back({Length, {}});
+  };
+
+  for (size_t I = 0, N = SA.size(); I < N; ++I) {
+    CloseIntervals(LCP[I]);
+    unsigned NextLCP = I + 1 < N ? LCP[I + 1] : 0;
+    if (NextLCP > LCP[I])
+      Open.push_back({NextLCP, {}});
+    Open.back().Leaves.push_back(SA[I]);
+  }
+  CloseIntervals(0);
+}
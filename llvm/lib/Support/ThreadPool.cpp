@@ -15,6 +15,7 @@
 #include "llvm/Config/llvm-config.h"
 
 #include "llvm/Support/FormatVariadic.h"
+#include "llvm/Support/Jobserver.h"
 #include "llvm/Support/Threading.h"
 #include "llvm/Support/raw_ostream.h"
 
@@ -97,7 +98,10 @@ void StdThreadPool::processTasks(ThreadPoolTaskGroup *WaitingForGroup) {
 #endif
 
     // Run the task we just grabbed
-    Task();
+    {
+      JobserverSlot Slot(Strategy.UseJobserver);
+      Task();
+    }
 
 #ifndef NDEBUG
     CurrentThreadTaskGroups->pop_back();
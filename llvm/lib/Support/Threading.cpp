@@ -99,6 +99,11 @@ std::optional<ThreadPoolStrategy>
 llvm::get_threadpool_strategy(StringRef Num, ThreadPoolStrategy Default) {
   if (Num == "all")
     return llvm::hardware_concurrency();
+  if (Num == "jobserver") {
+    ThreadPoolStrategy S = llvm::hardware_concurrency();
+    S.UseJobserver = true;
+    return S;
+  }
   if (Num.empty())
     return Default;
   unsigned V;
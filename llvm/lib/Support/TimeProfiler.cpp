@@ -11,13 +11,16 @@
 //===----------------------------------------------------------------------===//
 
 #include "llvm/Support/TimeProfiler.h"
+#include "llvm/ADT/DenseMap.h"
 #include "llvm/ADT/STLExtras.h"
 #include "llvm/ADT/STLFunctionalExtras.h"
 #include "llvm/ADT/StringMap.h"
+#include "llvm/Support/Format.h"
 #include "llvm/Support/JSON.h"
 #include "llvm/Support/Path.h"
 #include "llvm/Support/Process.h"
 #include "llvm/Support/Threading.h"
+#include "llvm/Support/raw_ostream.h"
 #include <algorithm>
 #include <cassert>
 #include <chrono>
@@ -75,10 +78,12 @@ struct llvm::TimeTraceProfilerEntry {
   const std::string Name;
   const std::string Detail;
   const bool AsyncEvent = false;
+  // Index of the call tree node this entry is accounted to.
+  const unsigned TreeNode = 0;
   TimeTraceProfilerEntry(TimePointType &&S, TimePointType &&E, std::string &&N,
-                         std::string &&Dt, bool Ae)
+                         std::string &&Dt, bool Ae, unsigned TN)
       : Start(std::move(S)), End(std::move(E)), Name(std::move(N)),
-        Detail(std::move(Dt)), AsyncEvent(Ae) {}
+        Detail(std::move(Dt)), AsyncEvent(Ae), TreeNode(TN) {}
 
   // Calculate timings for FlameGraph. Cast time points to microsecond precision
   // rather than casting duration. This avoids truncation issues causing inner
@@ -96,23 +101,60 @@ struct llvm::TimeTraceProfilerEntry {
   }
 };
 
+namespace {
+
+/// A node of the per-thread call tree. Entries are keyed by their name and the
+/// names of the entries that were open when they began, but not by detail.
+struct CallTreeNode {
+  StringRef Name;
+  size_t Count = 0;
+  DurationType Total = DurationType::zero();
+  SmallVector<unsigned, 4> Children;
+};
+
+} // anonymous namespace
+
 struct llvm::TimeTraceProfiler {
-  TimeTraceProfiler(unsigned TimeTraceGranularity = 0, StringRef ProcName = "")
+  TimeTraceProfiler(unsigned TimeTraceGranularity = 0, StringRef ProcName = "",
+                    TimeTraceProfilerMode Mode = TimeTraceProfilerMode::Events)
       : BeginningOfTime(system_clock::now()), StartTime(ClockType::now()),
         ProcName(ProcName), Pid(sys::Process::getProcessId()),
-        Tid(llvm::get_threadid()), TimeTraceGranularity(TimeTraceGranularity) {
+        Tid(llvm::get_threadid()), TimeTraceGranularity(TimeTraceGranularity),
+        Mode(Mode) {
     llvm::get_thread_name(ThreadName);
+    // Node 0 is the root of the call tree.
+    CallTree.emplace_back();
   }
 
   TimeTraceProfilerEntry *begin(std::string Name,
                                 llvm::function_ref<std::string()> Detail,
                                 bool AsyncEvent = false) {
+    // The call tree is only kept for summaries.
+    unsigned Node = 0;
+    if (Mode == TimeTraceProfilerMode::Summary)
+      Node = getOrAddChild(Stack.empty() ? 0 : Stack.back()->TreeNode, Name);
+    // Details are only shown for individual events, and computing them can be
+    // expensive, so skip them when only summarizing.
+    std::string DetailStr =
+        Mode == TimeTraceProfilerMode::Events ? Detail() : std::string();
     Stack.emplace_back(std::make_unique<TimeTraceProfilerEntry>(
-        ClockType::now(), TimePointType(), std::move(Name), Detail(),
-        AsyncEvent));
+        ClockType::now(), TimePointType(), std::move(Name),
+        std::move(DetailStr), AsyncEvent, Node));
     return Stack.back().get();
   }
 
+  unsigned getOrAddChild(unsigned Parent, StringRef Name) {
+    auto NameIt = NameIDs.try_emplace(Name, NameIDs.size()).first;
+    auto [It, Inserted] =
+        ChildNodes.try_emplace({Parent, NameIt->second}, CallTree.size());
+    if (Inserted) {
+      CallTree.emplace_back();
+      CallTree.back().Name = NameIt->first();
+      CallTree[Parent].Children.push_back(It->second);
+    }
+    return It->second;
+  }
+
   void end() {
     assert(!Stack.empty() && "Must call begin() first");
     end(*Stack.back().get());
@@ -125,8 +167,15 @@ struct llvm::TimeTraceProfiler {
     // Calculate duration at full precision for overall counts.
     DurationType Duration = E.End - E.Start;
 
+    if (Mode == TimeTraceProfilerMode::Summary) {
+      CallTreeNode &Node = CallTree[E.TreeNode];
+      ++Node.Count;
+      Node.Total += Duration;
+    }
+
     // Only include sections longer or equal to TimeTraceGranularity msec.
-    if (duration_cast<microseconds>(Duration).count() >= TimeTraceGranularity)
+    if (Mode == TimeTraceProfilerMode::Events &&
+        duration_cast<microseconds>(Duration).count() >= TimeTraceGranularity)
       Entries.emplace_back(E);
 
     // Track total time taken by each "name", but only the topmost levels of
@@ -293,9 +342,46 @@ struct llvm::TimeTraceProfiler {
     J.objectEnd();
   }
 
+  // Write the call tree of this thread as an indented table.
+  void writeSummary(raw_ostream &OS) const {
+    OS << "Thread " << Tid;
+    if (!ThreadName.empty())
+      OS << " (" << ThreadName << ")";
+    OS << ":\n";
+    OS << "  Total (ms)   Self (ms)      Count  Name\n";
+    writeSummaryNode(OS, 0, 0);
+  }
+
+  void writeSummaryNode(raw_ostream &OS, unsigned Idx, unsigned Depth) const {
+    const CallTreeNode &Node = CallTree[Idx];
+    SmallVector<unsigned, 4> Children(Node.Children);
+    llvm::sort(Children, [&](unsigned A, unsigned B) {
+      return CallTree[A].Total > CallTree[B].Total;
+    });
+
+    if (Idx != 0) {
+      DurationType Self = Node.Total;
+      for (unsigned Child : Children)
+        Self -= CallTree[Child].Total;
+      auto toMs = [](DurationType D) {
+        return duration<double, std::milli>(D).count();
+      };
+      OS << format("%12.3f%12.3f%11zu  ", toMs(Node.Total), toMs(Self),
+                   Node.Count);
+      OS.indent(2 * (Depth - 1)) << Node.Name << '\n';
+    }
+    for (unsigned Child : Children)
+      writeSummaryNode(OS, Child, Depth + 1);
+  }
+
   SmallVector<std::unique_ptr<TimeTraceProfilerEntry>, 16> Stack;
   SmallVector<TimeTraceProfilerEntry, 128> Entries;
   StringMap<CountAndDurationType> CountAndTotalPerName;
+  std::vector<CallTreeNode> CallTree;
+  // Interned entry names, which the call tree nodes refer to.
+  StringMap<unsigned> NameIDs;
+  // The child of a call tree node with a given name ID.
+  DenseMap<std::pair<unsigned, unsigned>, unsigned> ChildNodes;
   // System clock time when the session was begun.
   const time_point<system_clock> BeginningOfTime;
   // Profiling clock time when the session was begun.
@@ -307,14 +393,17 @@ struct llvm::TimeTraceProfiler {
 
   // Minimum time granularity (in microseconds)
   const unsigned TimeTraceGranularity;
+
+  const TimeTraceProfilerMode Mode;
 };
 
 void llvm::timeTraceProfilerInitialize(unsigned TimeTraceGranularity,
-                                       StringRef ProcName) {
+                                       StringRef ProcName,
+                                       TimeTraceProfilerMode Mode) {
   assert(TimeTraceProfilerInstance == nullptr &&
          "Profiler should not be initialized");
   TimeTraceProfilerInstance = new TimeTraceProfiler(
-      TimeTraceGranularity, llvm::sys::path::filename(ProcName));
+      TimeTraceGranularity, llvm::sys::path::filename(ProcName), Mode);
 }
 
 // Removes all TimeTraceProfilerInstances.
@@ -345,6 +434,16 @@ void llvm::timeTraceProfilerWrite(raw_pwrite_stream &OS) {
   TimeTraceProfilerInstance->write(OS);
 }
 
+void llvm::timeTraceProfilerWriteSummary(raw_ostream &OS) {
+  assert(TimeTraceProfilerInstance != nullptr &&
+         "Profiler object can't be null");
+  auto &Instances = getTimeTraceProfilerInstances();
+  std::lock_guard<std::mutex> Lock(Instances.Lock);
+  TimeTraceProfilerInstance->writeSummary(OS);
+  for (const TimeTraceProfiler *TTP : Instances.List)
+    TTP->writeSummary(OS);
+}
+
 Error llvm::timeTraceProfilerWrite(StringRef PreferredFileName,
                                    StringRef FallbackFileName) {
   assert(TimeTraceProfilerInstance != nullptr &&
@@ -16,6 +16,7 @@
 #include "llvm/Support/AutoConvert.h"
 #include "llvm/Support/Compiler.h"
 #include "llvm/Support/Duration.h"
+#include "llvm/Support/Errc.h"
 #include "llvm/Support/ErrorHandling.h"
 #include "llvm/Support/FileSystem.h"
 #include "llvm/Support/Format.h"
@@ -24,6 +25,7 @@
 #include "llvm/Support/NativeFormatting.h"
 #include "llvm/Support/Process.h"
 #include "llvm/Support/Program.h"
+#include "llvm/Support/TimeProfiler.h"
 #include <algorithm>
 #include <cerrno>
 #include <cstdio>
@@ -954,6 +956,127 @@ bool raw_fd_stream::classof(const raw_ostream *OS) {
   return OS->get_kind() == OStreamKind::OK_FDStream;
 }
 
+//===----------------------------------------------------------------------===//
+//  raw_mmap_ostream
+//===----------------------------------------------------------------------===//
+
+raw_mmap_ostream::raw_mmap_ostream(StringRef Filename, sys::fs::TempFile Temp)
+    : FinalPath(Filename),
+      Temp(std::make_unique<sys::fs::TempFile>(std::move(Temp))),
+      Region(std::make_unique<sys::fs::mapped_file_region>()) {}
+
+Expected<std::unique_ptr<raw_mmap_ostream>>
+raw_mmap_ostream::create(StringRef Filename, size_t SizeHint) {
+  if (Filename == "-")
+    return errorCodeToError(errc::not_supported);
+
+  // As with FileOutputBuffer, don't replace special files such as /dev/null
+  // with a regular file.
+  sys::fs::file_status Stat;
+  sys::fs::status(Filename, Stat);
+  switch (Stat.type()) {
+  case sys::fs::file_type::directory_file:
+    return errorCodeToError(errc::is_a_directory);
+  case sys::fs::file_type::regular_file:
+  case sys::fs::file_type::file_not_found:
+  case sys::fs::file_type::status_error:
+    break;
+  default:
+    return errorCodeToError(errc::not_supported);
+  }
+
+  Expected<sys::fs::TempFile> FileOrErr = sys::fs::TempFile::create(
+      Filename + ".tmp%%%%%%%", sys::fs::all_read | sys::fs::all_write);
+  if (!FileOrErr)
+    return FileOrErr.takeError();
+
+  std::unique_ptr<raw_mmap_ostream> OS(
+      new raw_mmap_ostream(Filename, std::move(*FileOrErr)));
+  // Start with at least 1 MiB so that small outputs don't remap repeatedly.
+  if (std::error_code EC = OS->reserve(std::max<size_t>(SizeHint, 1 << 20)))
+    return errorCodeToError(EC);
+  OS->resetBuffer();
+  return std::move(OS);
+}
+
+raw_mmap_ostream::~raw_mmap_ostream() {
+  if (*Region) {
+    flush();
+    SetUnbuffered();
+  }
+  // Close the mapping before deleting the temp file, so that the removal
+  // succeeds.
+  Region->unmap();
+  consumeError(Temp->discard());
+}
+
+std::error_code raw_mmap_ostream::reserve(uint64_t MinSize) {
+  // Grow geometrically to keep the number of remappings logarithmic.
+  uint64_t OldSize = *Region ? Region->size() : 0;
+  uint64_t NewSize = std::max<uint64_t>(MinSize, OldSize * 2);
+  Region->unmap();
+  if (std::error_code EC =
+          sys::fs::resize_file_before_mapping_readwrite(Temp->FD, NewSize))
+    return EC;
+  std::error_code EC;
+  *Region = sys::fs::mapped_file_region(
+      sys::fs::convertFDToNativeFile(Temp->FD),
+      sys::fs::mapped_file_region::readwrite, NewSize, 0, EC);
+  return EC;
+}
+
+void raw_mmap_ostream::resetBuffer() {
+  SetBuffer(Region->data() + Pos, Region->size() - Pos);
+}
+
+void raw_mmap_ostream::write_impl(const char *Ptr, size_t Size) {
+  if (EC)
+    return;
+  assert(*Region && "raw_mmap_ostream written to after commit()");
+
+  // Normally the data is already in place because the buffer is part of the
+  // mapping. raw_ostream passes large writes through without buffering them,
+  // though, and those have to be copied.
+  if (Ptr != Region->data() + Pos) {
+    if (Pos + Size > Region->size())
+      EC = reserve(Pos + Size);
+    if (!EC)
+      memcpy(Region->data() + Pos, Ptr, Size);
+  }
+  if (!EC) {
+    Pos += Size;
+    if (Pos == Region->size())
+      EC = reserve(Pos + 1);
+  }
+  if (EC) {
+    SetUnbuffered();
+    return;
+  }
+  resetBuffer();
+}
+
+void raw_mmap_ostream::pwrite_impl(const char *Ptr, size_t Size,
+                                   uint64_t Offset) {
+  if (EC)
+    return;
+  assert(Offset + Size <= Region->size() && "pwrite beyond end of stream");
+  memcpy(Region->data() + Offset, Ptr, Size);
+}
+
+Error raw_mmap_ostream::commit() {
+  llvm::TimeTraceScope timeScope("Commit stream to disk");
+  flush();
+  SetUnbuffered();
+
+  // Unmap the file, letting the OS flush dirty pages to disk.
+  Region->unmap();
+  if (EC)
+    return errorCodeToError(EC);
+  if (std::error_code EC = sys::fs::resize_file(Temp->FD, Pos))
+    return errorCodeToError(EC);
+  return Temp->keep(FinalPath);
+}
+
 //===----------------------------------------------------------------------===//
 //  raw_string_ostream
 //===----------------------------------------------------------------------===//
@@ -126,7 +126,11 @@ int llvm::TableGenMain(const char *argv0,
     return 1;
   Records.stopTimer();
 
-  // Write output to memory.
+  // Write output to memory. Exactly one backend runs per invocation. Backends
+  // are free to add records and to cache derived state, such as CodeGenTarget,
+  // in the RecordKeeper. They also share the uniqued Init pool and SrcMgr. So
+  // several backends cannot safely run over one parse, either in sequence or
+  // in parallel.
   Records.startBackendTimer("Backend overall");
   std::string OutString;
   raw_string_ostream Out(OutString);
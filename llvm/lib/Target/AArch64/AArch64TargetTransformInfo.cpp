@@ -3206,7 +3206,9 @@ InstructionCost AArch64TTIImpl::getGatherScatterOpCost(
                       {TTI::OK_AnyValue, TTI::OP_None}, I);
   // Add on an overhead cost for using gathers/scatters.
   // TODO: At the moment this is applied unilaterally for all CPUs, but at some
-  // point we may want a per-CPU overhead.
+  // point we may want a per-CPU overhead. Until there are measured numbers to
+  // put in AArch64Subtarget, -sve-gather-overhead and -sve-scatter-overhead
+  // can be used to check whether a scalable VF would win on a given core.
   MemOpCost *= getSVEGatherScatterOverhead(Opcode);
   return LT.first * MemOpCost * getMaxNumElements(LegalVF);
 }
@@ -105,6 +105,12 @@ cl::opt<bool> X86AlignBranchWithin32BBoundaries(
         "assumptions about labels corresponding to particular instructions, "
         "and should be used with caution."));
 
+cl::opt<bool> X86AlignBranchSkipCold(
+    "x86-align-branch-skip-cold", cl::init(false), cl::Hidden,
+    cl::desc("Don't align branches in sections that hold code known to be "
+             "cold, such as .text.unlikely and .text.split, which profile "
+             "guided layout and machine function splitting place there"));
+
 cl::opt<unsigned> X86PadMaxPrefixSize(
     "x86-pad-max-prefix-size", cl::init(0),
     cl::desc("Maximum number of prefixes to use for padding"));
@@ -484,7 +490,13 @@ bool X86AsmBackend::canPadBranches(MCObjectStreamer &OS) const {
   assert(allowAutoPadding() && "incorrect initialization!");
 
   // We only pad in text section.
-  if (!OS.getCurrentSectionOnly()->getKind().isText())
+  const MCSection *Sec = OS.getCurrentSectionOnly();
+  if (!Sec->getKind().isText())
+    return false;
+
+  // Padding cold code costs size without a measurable frontend benefit.
+  if (X86AlignBranchSkipCold && (Sec->getName().starts_with(".text.unlikely") ||
+                                 Sec->getName().starts_with(".text.split")))
     return false;
 
   // To be Done: Currently don't deal with Bundle cases.
@@ -70,6 +70,8 @@ STATISTIC(NumImportedGlobalVars,
 STATISTIC(NumImportedModules, "Number of modules imported from");
 STATISTIC(NumDeadSymbols, "Number of dead stripped symbols in index");
 STATISTIC(NumLiveSymbols, "Number of live symbols in index");
+STATISTIC(NumPrunedImportsThinLink,
+          "Number of import candidates skipped due to the import prune list");
 
 /// Limit on instruction count of imported functions.
 static cl::opt<unsigned> ImportInstrLimit(
@@ -163,10 +165,50 @@ static cl::opt<std::string> WorkloadDefinitions(
              "}"),
     cl::Hidden);
 
+/// Pass a list of functions that should not be imported, typically the ones
+/// a previous build imported but never inlined (e.g. as found from its
+/// -pass-remarks-missed=inline output). Importing these only costs backend
+/// compile time. The file has one entry per line: either a function name or
+/// its GUID in decimal. As with -thinlto-workload-def, local functions can only
+/// be named if -funique-internal-linkage-names was used; otherwise give their
+/// GUID.
+static cl::opt<std::string> ImportPruneList(
+    "thinlto-import-prune-list", cl::Hidden,
+    cl::desc("A file listing functions, by name or decimal GUID, one per line, "
+             "that ThinLTO should not import (e.g. functions that were "
+             "imported but never inlined in a previous build)"));
+
 namespace llvm {
 extern cl::opt<bool> EnableMemProfContextDisambiguation;
 }
 
+/// Returns the GUIDs listed in -thinlto-import-prune-list, read on first use.
+static const DenseSet<GlobalValue::GUID> &getPrunedImports() {
+  static const DenseSet<GlobalValue::GUID> Pruned = [] {
+    DenseSet<GlobalValue::GUID> Pruned;
+    if (ImportPruneList.empty())
+      return Pruned;
+    auto BufferOrErr = MemoryBuffer::getFileOrSTDIN(ImportPruneList);
+    if (std::error_code EC = BufferOrErr.getError())
+      report_fatal_error("Failed to open import prune list " +
+                         Twine(ImportPruneList) + ": " + EC.message());
+    SmallVector<StringRef, 0> Lines;
+    (*BufferOrErr)->getBuffer().split(Lines, '\n', /*MaxSplit=*/-1,
+                                      /*KeepEmpty=*/false);
+    for (StringRef Line : Lines) {
+      Line = Line.trim();
+      if (Line.empty())
+        continue;
+      GlobalValue::GUID GUID;
+      if (Line.getAsInteger(10, GUID))
+        GUID = GlobalValue::getGUID(Line);
+      Pruned.insert(GUID);
+    }
+    return Pruned;
+  }();
+  return Pruned;
+}
+
 // Load lazily a module from \p FileName in \p Context.
 static std::unique_ptr<Module> loadFile(const std::string &FileName,
                                         LLVMContext &Context) {
@@ -712,6 +754,12 @@ static void computeImportForFunction(
       continue;
     }
 
+    if (!ImportPruneList.empty() && getPrunedImports().count(VI.getGUID())) {
+      LLVM_DEBUG(dbgs() << "ignored! Target is in the import prune list.\n");
+      ++NumPrunedImportsThinLink;
+      continue;
+    }
+
     auto GetBonusMultiplier = [](CalleeInfo::HotnessType Hotness) -> float {
       if (Hotness == CalleeInfo::HotnessType::Hot)
         return ImportHotMultiplier;
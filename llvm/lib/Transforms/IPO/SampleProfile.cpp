@@ -66,6 +66,7 @@
 #include "llvm/Support/CommandLine.h"
 #include "llvm/Support/Debug.h"
 #include "llvm/Support/ErrorOr.h"
+#include "llvm/Support/TimeProfiler.h"
 #include "llvm/Support/VirtualFileSystem.h"
 #include "llvm/Support/raw_ostream.h"
 #include "llvm/Transforms/IPO.h"
@@ -1957,6 +1958,10 @@ SampleProfileLoader::buildFunctionOrder(Module &M, LazyCallGraph &CG) {
 bool SampleProfileLoader::doInitialization(Module &M,
                                            FunctionAnalysisManager *FAM) {
   auto &Ctx = M.getContext();
+  // Reading the profile is often the dominant cost of this pass on large
+  // profiles. Extensible binary profiles with a function offset table only
+  // load the functions of the current module, see setModule below.
+  TimeTraceScope TimeScope("ReadSampleProfile", Filename);
 
   auto ReaderOrErr = SampleProfileReader::create(
       Filename, Ctx, *FS, FSDiscriminatorPass::Base, RemappingFilename);
@@ -5270,7 +5270,7 @@ static bool combineInstructionsOverFunction(
     MadeIRChange = LowerDbgDeclare(F);
 
   // Iterate while there is work to do.
-  unsigned Iteration = 0;
+  unsigned Iteration = 0, NumIterations = 0;
   while (true) {
     ++Iteration;
 
@@ -5282,6 +5282,7 @@ static bool combineInstructionsOverFunction(
     }
 
     ++NumWorklistIterations;
+    ++NumIterations;
     LLVM_DEBUG(dbgs() << "\n\nINSTCOMBINE ITERATION #" << Iteration << " on "
                       << F.getName() << "\n");
 
@@ -5302,6 +5303,15 @@ static bool combineInstructionsOverFunction(
     }
   }
 
+  // A single iteration is the common case; only report functions that needed
+  // more to settle.
+  if (NumIterations > 1)
+    ORE.emit([&]() {
+      return OptimizationRemarkAnalysis(DEBUG_TYPE, "Iterations", &F)
+             << "ran " << ore::NV("Iterations", NumIterations)
+             << " iterations over the function";
+    });
+
   if (Iteration == 1)
     ++NumOneIteration;
   else if (Iteration == 2)
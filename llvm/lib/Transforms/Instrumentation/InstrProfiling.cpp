@@ -983,6 +983,10 @@ void InstrLowerer::lowerIncrement(InstrProfIncrementInst *Inc) {
     Builder.CreateAtomicRMW(AtomicRMWInst::Add, Addr, Inc->getStep(),
                             MaybeAlign(), AtomicOrdering::Monotonic);
   } else {
+    // All threads share one set of counters, so threads running the same hot
+    // code contend on the counters' cache lines and can lose updates. Counter
+    // promotion reduces that by keeping loop counts in registers and updating
+    // memory once per loop exit.
     Value *IncStep = Inc->getStep();
     Value *Load = Builder.CreateLoad(IncStep->getType(), Addr, "pgocount");
     auto *Count = Builder.CreateAdd(Load, Inc->getStep());
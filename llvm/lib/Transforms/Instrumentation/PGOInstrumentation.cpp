@@ -104,6 +104,7 @@
 #include "llvm/Support/Error.h"
 #include "llvm/Support/ErrorHandling.h"
 #include "llvm/Support/GraphWriter.h"
+#include "llvm/Support/TimeProfiler.h"
 #include "llvm/Support/VirtualFileSystem.h"
 #include "llvm/Support/raw_ostream.h"
 #include "llvm/TargetParser/Triple.h"
@@ -1965,9 +1966,13 @@ static bool annotateAllFunctions(
     ProfileSummaryInfo *PSI, bool IsCS) {
   LLVM_DEBUG(dbgs() << "Read in profile counters: ");
   auto &Ctx = M.getContext();
-  // Read the counter array from file.
-  auto ReaderOrErr = IndexedInstrProfReader::create(ProfileFileName, FS,
-                                                    ProfileRemappingFileName);
+  // Read the counter array from file. Opening the indexed profile only reads
+  // its header and summary; records are looked up per function below.
+  auto ReaderOrErr = [&] {
+    TimeTraceScope TimeScope("ReadInstrProfile", ProfileFileName);
+    return IndexedInstrProfReader::create(ProfileFileName, FS,
+                                          ProfileRemappingFileName);
+  }();
   if (Error E = ReaderOrErr.takeError()) {
     handleAllErrors(std::move(E), [&](const ErrorInfoBase &EI) {
       Ctx.diagnose(
@@ -26,11 +26,14 @@
 #include "llvm/IR/GlobalObject.h"
 #include "llvm/IR/GlobalValue.h"
 #include "llvm/IR/GlobalVariable.h"
+#include "llvm/IR/InstIterator.h"
 #include "llvm/IR/Instruction.h"
 #include "llvm/IR/Module.h"
 #include "llvm/IR/User.h"
 #include "llvm/IR/Value.h"
+#include "llvm/Support/BalancedPartitioning.h"
 #include "llvm/Support/Casting.h"
+#include "llvm/Support/CommandLine.h"
 #include "llvm/Support/Debug.h"
 #include "llvm/Support/ErrorHandling.h"
 #include "llvm/Support/MD5.h"
@@ -49,6 +52,12 @@ using namespace llvm;
 
 #define DEBUG_TYPE "split-module"
 
+static cl::opt<bool> SplitByCallGraph(
+    "split-module-by-call-graph", cl::init(false), cl::Hidden,
+    cl::desc("Assign globals to partitions by balanced partitioning of the "
+             "reference graph, keeping callers and callees together, and "
+             "balance the partitions by instruction count"));
+
 namespace {
 
 using ClusterMapType = EquivalenceClasses<const GlobalValue *>;
@@ -96,6 +105,89 @@ static const GlobalObject *getGVPartitioningRoot(const GlobalValue *GV) {
   return GO;
 }
 
+// Assign every cluster in GVtoClusterMap to one of N partitions. The clusters
+// are ordered with balanced partitioning so that clusters referring to the
+// same globals are close to each other, and that order is then cut into N
+// ranges of roughly equal instruction count.
+static void findCallGraphPartitions(Module &M, ClusterMapType &GVtoClusterMap,
+                                    ClusterIDMapType &ClusterIDMap,
+                                    unsigned N) {
+  // Number the clusters in module order, for determinism.
+  SmallVector<const GlobalValue *, 0> Leaders;
+  DenseMap<const GlobalValue *, unsigned> ClusterOf;
+  DenseMap<const GlobalValue *, unsigned> LeaderIndex;
+  auto NumberCluster = [&](const GlobalValue &GV) {
+    if (GVtoClusterMap.findValue(&GV) == GVtoClusterMap.end())
+      return;
+    const GlobalValue *Leader = GVtoClusterMap.getLeaderValue(&GV);
+    auto [It, Inserted] = LeaderIndex.try_emplace(Leader, Leaders.size());
+    if (Inserted)
+      Leaders.push_back(Leader);
+    ClusterOf[&GV] = It->second;
+  };
+  llvm::for_each(M.functions(), NumberCluster);
+  llvm::for_each(M.globals(), NumberCluster);
+  llvm::for_each(M.aliases(), NumberCluster);
+  if (Leaders.empty())
+    return;
+
+  // A cluster's utility nodes are itself and the clusters it refers to, so
+  // that balanced partitioning puts callers next to their callees and next
+  // to other callers of the same functions.
+  std::vector<SmallVector<BPFunctionNode::UtilityNodeT, 4>> Utilities(
+      Leaders.size());
+  std::vector<uint64_t> Weights(Leaders.size(), 0);
+  for (const auto &[GV, ID] : ClusterOf) {
+    Weights[ID] += 1;
+    const auto *F = dyn_cast<Function>(GV);
+    if (!F)
+      continue;
+    for (const Instruction &I : instructions(F)) {
+      ++Weights[ID];
+      for (const Value *Op : I.operands()) {
+        auto It = ClusterOf.find(dyn_cast<GlobalValue>(Op));
+        if (It != ClusterOf.end() && It->second != ID)
+          Utilities[ID].push_back(It->second);
+      }
+    }
+  }
+
+  std::vector<BPFunctionNode> Nodes;
+  Nodes.reserve(Leaders.size());
+  uint64_t TotalWeight = 0;
+  for (unsigned ID = 0, E = Leaders.size(); ID != E; ++ID) {
+    auto &U = Utilities[ID];
+    U.push_back(ID);
+    llvm::sort(U);
+    U.erase(std::unique(U.begin(), U.end()), U.end());
+    Nodes.emplace_back(ID, U);
+    TotalWeight += Weights[ID];
+  }
+  BalancedPartitioningConfig Config;
+  BalancedPartitioning BP(Config);
+  BP.run(Nodes);
+
+  // Each cluster goes to the partition its first instruction falls into.
+  uint64_t Offset = 0;
+  for (const BPFunctionNode &Node : Nodes) {
+    unsigned ClusterID = std::min<uint64_t>(N - 1, Offset * N / TotalWeight);
+    Offset += Weights[Node.Id];
+    for (ClusterMapType::member_iterator
+             MI = GVtoClusterMap.findLeader(Leaders[Node.Id]),
+             ME = GVtoClusterMap.member_end();
+         MI != ME; ++MI)
+      ClusterIDMap[*MI] = ClusterID;
+  }
+
+  // Ifuncs are not clustered, so keep them with their resolvers here rather
+  // than leaving them to the name hash.
+  for (const GlobalIFunc &GIF : M.ifuncs()) {
+    auto It = ClusterIDMap.find(getGVPartitioningRoot(&GIF));
+    if (It != ClusterIDMap.end())
+      ClusterIDMap[&GIF] = It->second;
+  }
+}
+
 // Find partitions for module in the way that no locals need to be
 // globalized.
 // Try to balance pack those partitions into N files since this roughly equals
@@ -116,6 +208,11 @@ static void findPartitions(Module &M, ClusterIDMapType &ClusterIDMap,
     if (!GV.hasName())
       GV.setName("__llvmsplit_unnamed");
 
+    // Every definition is placed through its cluster when partitioning by
+    // call graph, not only those that must stay together.
+    if (SplitByCallGraph)
+      GVtoClusterMap.insert(&GV);
+
     // Comdat groups must not be partitioned. For comdat groups that contain
     // locals, record all their members here so we can keep them together.
     // Comdat groups that only contain external globals are already handled by
@@ -151,6 +248,9 @@ static void findPartitions(Module &M, ClusterIDMapType &ClusterIDMap,
   llvm::for_each(M.globals(), recordGVSet);
   llvm::for_each(M.aliases(), recordGVSet);
 
+  if (SplitByCallGraph)
+    return findCallGraphPartitions(M, GVtoClusterMap, ClusterIDMap, N);
+
   // Assigned all GVs to merged clusters while balancing number of objects in
   // each.
   auto CompareClusters = [](const std::pair<unsigned, unsigned> &a,
@@ -7294,6 +7294,9 @@ LoopVectorizationPlanner::planInVPlanNativePath(ElementCount UserVF) {
     if (VPlanBuildStressTest)
       return VectorizationFactor::Disabled();
 
+    // There is no cost model for outer loops yet, which is why this path is
+    // only taken for loops with explicit vectorization hints (see
+    // isExplicitVecOuterLoop) and must not be enabled by default.
     return {VF, 0 /*Cost*/, 0 /* ScalarCost */};
   }
 
@@ -155,6 +155,14 @@ static cl::opt<int>
 ScheduleRegionSizeBudget("slp-schedule-budget", cl::init(100000), cl::Hidden,
     cl::desc("Limit the size of the SLP scheduling region per block"));
 
+/// Limits the number of tree nodes built per function, to bound compile time
+/// on very large straight-line blocks. Once the budget is used up, remaining
+/// bundles are gathered. 0 means no limit.
+static cl::opt<unsigned> TreeNodeBudget(
+    "slp-tree-node-budget", cl::init(0), cl::Hidden,
+    cl::desc("Limit the number of SLP tree nodes built per function "
+             "(0 = unlimited)"));
+
 static cl::opt<int> MinVectorRegSizeOption(
     "slp-min-reg-size", cl::init(128), cl::Hidden,
     cl::desc("Attempt to vectorize for this register size in bits"));
@@ -3712,6 +3720,10 @@ private:
   const DataLayout *DL;
   OptimizationRemarkEmitter *ORE;
 
+  /// Number of tree nodes built for this function, checked against
+  /// TreeNodeBudget.
+  unsigned NumTreeNodesBuilt = 0;
+
   unsigned MaxVecRegSize; // This is set by TTI or overridden by cl::opt.
   unsigned MinVecRegSize; // Set by cl::opt (default: 128).
 
@@ -6368,6 +6380,23 @@ void BoUpSLP::buildTree_rec(ArrayRef<Value *> VL, unsigned Depth,
     }
   }
 
+  // Gather if the function's tree node budget is used up.
+  if (TreeNodeBudget && NumTreeNodesBuilt >= TreeNodeBudget) {
+    if (NumTreeNodesBuilt++ == TreeNodeBudget)
+      ORE->emit([&]() {
+        return OptimizationRemarkMissed(SV_NAME, "TreeNodeBudget", F)
+               << "SLP vectorization stopped building trees after "
+               << ore::NV("TreeNodes", TreeNodeBudget.getValue())
+               << " tree nodes; the remaining bundles were gathered";
+      });
+    LLVM_DEBUG(dbgs() << "SLP: Gathering due to tree node budget.\n");
+    if (TryToFindDuplicates(S))
+      newTreeEntry(VL, std::nullopt /*not vectorized*/, S, UserTreeIdx,
+                   ReuseShuffleIndicies);
+    return;
+  }
+  ++NumTreeNodesBuilt;
+
   // Gather if we hit the RecursionMaxDepth, unless this is a load (or z/sext of
   // a load), in which case peek through to include it in the tree, without
   // ballooning over-budget.
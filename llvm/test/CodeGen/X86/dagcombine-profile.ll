@@ -0,0 +1,42 @@
+; RUN: llc -mtriple=x86_64-- < %s -o %t.default
+; RUN: llc -mtriple=x86_64-- -combiner-skip-unchanged-nodes < %s -o %t.skip
+; RUN: diff %t.default %t.skip
+; RUN: llc -mtriple=x86_64-- -combiner-profile < %s -o /dev/null 2>&1 \
+; RUN:   | FileCheck %s --check-prefix=PROFILE
+
+; Skipping nodes that failed to combine and have not changed since must not
+; change the code generated for these, and -combiner-profile reports each
+; opcode that was visited with the number of its visits that combined.
+
+; PROFILE:     DAG Combiner Profile
+; PROFILE:     Total Execution Time:
+; PROFILE-DAG: mul ({{[1-9][0-9]*}} of {{[1-9][0-9]*}} visits combined)
+; PROFILE-DAG: add ({{[0-9]+}} of {{[1-9][0-9]*}} visits combined)
+
+define i32 @mul_add(i32 %a, i32 %b) {
+  %m = mul i32 %a, 8
+  %s = add i32 %m, %b
+  ret i32 %s
+}
+
+define i32 @sum(ptr %p, i32 %n) {
+entry:
+  br label %loop
+
+loop:
+  %i = phi i32 [ 0, %entry ], [ %i.next, %loop ]
+  %acc = phi i32 [ 0, %entry ], [ %acc.next, %loop ]
+  %idx = zext i32 %i to i64
+  %gep = getelementptr inbounds i32, ptr %p, i64 %idx
+  %v = load i32, ptr %gep
+  %sh = shl i32 %v, 2
+  %x = xor i32 %sh, -1
+  %y = and i32 %x, 255
+  %acc.next = add i32 %acc, %y
+  %i.next = add nuw i32 %i, 1
+  %done = icmp eq i32 %i.next, %n
+  br i1 %done, label %exit, label %loop
+
+exit:
+  ret i32 %acc.next
+}
@@ -0,0 +1,78 @@
+; RUN: llc -mtriple=x86_64-- -greedy-region-split-budget=1 \
+; RUN:   -pass-remarks-analysis=regalloc -o /dev/null < %s 2>&1 | FileCheck %s
+; RUN: llc -mtriple=x86_64-- -pass-remarks-analysis=regalloc -o /dev/null \
+; RUN:   < %s 2>&1 | FileCheck %s --check-prefix=UNLIMITED --allow-empty
+
+; Sixteen values live across a loop with a call need more registers than
+; there are callee-saved ones, so several of their live ranges are split.
+; With a budget of one region split the allocator reports once that it
+; falls back to block splitting for the rest.
+
+; CHECK: remark: <unknown>:0:0: region split budget of 1 exhausted; using block splitting for the remaining live ranges
+; CHECK-NOT: region split budget
+
+; UNLIMITED-NOT: region split budget
+
+declare void @g()
+
+define void @f(ptr %p, i32 %n) {
+entry:
+  %v0 = load volatile i32, ptr %p, align 4
+  %p1 = getelementptr inbounds i32, ptr %p, i64 1
+  %v1 = load volatile i32, ptr %p1, align 4
+  %p2 = getelementptr inbounds i32, ptr %p, i64 2
+  %v2 = load volatile i32, ptr %p2, align 4
+  %p3 = getelementptr inbounds i32, ptr %p, i64 3
+  %v3 = load volatile i32, ptr %p3, align 4
+  %p4 = getelementptr inbounds i32, ptr %p, i64 4
+  %v4 = load volatile i32, ptr %p4, align 4
+  %p5 = getelementptr inbounds i32, ptr %p, i64 5
+  %v5 = load volatile i32, ptr %p5, align 4
+  %p6 = getelementptr inbounds i32, ptr %p, i64 6
+  %v6 = load volatile i32, ptr %p6, align 4
+  %p7 = getelementptr inbounds i32, ptr %p, i64 7
+  %v7 = load volatile i32, ptr %p7, align 4
+  %p8 = getelementptr inbounds i32, ptr %p, i64 8
+  %v8 = load volatile i32, ptr %p8, align 4
+  %p9 = getelementptr inbounds i32, ptr %p, i64 9
+  %v9 = load volatile i32, ptr %p9, align 4
+  %p10 = getelementptr inbounds i32, ptr %p, i64 10
+  %v10 = load volatile i32, ptr %p10, align 4
+  %p11 = getelementptr inbounds i32, ptr %p, i64 11
+  %v11 = load volatile i32, ptr %p11, align 4
+  %p12 = getelementptr inbounds i32, ptr %p, i64 12
+  %v12 = load volatile i32, ptr %p12, align 4
+  %p13 = getelementptr inbounds i32, ptr %p, i64 13
+  %v13 = load volatile i32, ptr %p13, align 4
+  %p14 = getelementptr inbounds i32, ptr %p, i64 14
+  %v14 = load volatile i32, ptr %p14, align 4
+  %p15 = getelementptr inbounds i32, ptr %p, i64 15
+  %v15 = load volatile i32, ptr %p15, align 4
+  br label %loop
+
+loop:
+  %i = phi i32 [ 0, %entry ], [ %i.next, %loop ]
+  call void @g()
+  %i.next = add i32 %i, 1
+  %done = icmp eq i32 %i.next, %n
+  br i1 %done, label %exit, label %loop
+
+exit:
+  store volatile i32 %v0, ptr %p, align 4
+  store volatile i32 %v1, ptr %p1, align 4
+  store volatile i32 %v2, ptr %p2, align 4
+  store volatile i32 %v3, ptr %p3, align 4
+  store volatile i32 %v4, ptr %p4, align 4
+  store volatile i32 %v5, ptr %p5, align 4
+  store volatile i32 %v6, ptr %p6, align 4
+  store volatile i32 %v7, ptr %p7, align 4
+  store volatile i32 %v8, ptr %p8, align 4
+  store volatile i32 %v9, ptr %p9, align 4
+  store volatile i32 %v10, ptr %p10, align 4
+  store volatile i32 %v11, ptr %p11, align 4
+  store volatile i32 %v12, ptr %p12, align 4
+  store volatile i32 %v13, ptr %p13, align 4
+  store volatile i32 %v14, ptr %p14, align 4
+  store volatile i32 %v15, ptr %p15, align 4
+  ret void
+}
@@ -0,0 +1,90 @@
+; RUN: rm -rf %t && split-file %s %t
+; RUN: llc -mtriple=x86_64-- -enable-machine-outliner \
+; RUN:   -outliner-sequence-hash-remarks -pass-remarks=machine-outliner \
+; RUN:   -pass-remarks-analysis=machine-outliner -o /dev/null %t/a.ll 2> %t/a.txt
+; RUN: llc -mtriple=x86_64-- -enable-machine-outliner \
+; RUN:   -outliner-sequence-hash-remarks -pass-remarks=machine-outliner \
+; RUN:   -pass-remarks-analysis=machine-outliner -o /dev/null %t/b.ll 2> %t/b.txt
+; RUN: FileCheck %s < %t/a.txt
+; RUN: FileCheck %s < %t/b.txt
+; RUN: grep -o 'Sequence hash: [0-9]*' %t/a.txt > %t/a.hash
+; RUN: grep -o 'Sequence hash: [0-9]*' %t/b.txt > %t/b.hash
+; RUN: diff %t/a.hash %t/b.hash
+; RUN: llc -mtriple=x86_64-- -enable-machine-outliner \
+; RUN:   -pass-remarks=machine-outliner -pass-remarks-analysis=machine-outliner \
+; RUN:   -o /dev/null %t/a.ll 2>&1 | FileCheck %s --check-prefix=NOHASH
+
+; With -outliner-sequence-hash-remarks each outlined function is followed by
+; a remark with the hash of its sequence. The same sequence gets the same
+; hash in another module, even though the functions it is outlined from
+; differ. Without the option the hash is not reported.
+
+; CHECK:      remark: <unknown>:0:0: Saved {{[0-9]+}} bytes by outlining {{[0-9]+}} instructions from 3 locations.
+; CHECK-NEXT: remark: <unknown>:0:0: Sequence hash: {{[0-9]+}}
+
+; NOHASH:     remark: <unknown>:0:0: Saved {{[0-9]+}} bytes by outlining
+; NOHASH-NOT: Sequence hash
+
+;--- a.ll
+@g = global i32 0
+
+define void @f1() #0 {
+  store volatile i32 1, ptr @g, align 4
+  store volatile i32 2, ptr @g, align 4
+  store volatile i32 3, ptr @g, align 4
+  store volatile i32 4, ptr @g, align 4
+  ret void
+}
+
+define void @f2() #0 {
+  store volatile i32 1, ptr @g, align 4
+  store volatile i32 2, ptr @g, align 4
+  store volatile i32 3, ptr @g, align 4
+  store volatile i32 4, ptr @g, align 4
+  ret void
+}
+
+define void @f3() #0 {
+  store volatile i32 1, ptr @g, align 4
+  store volatile i32 2, ptr @g, align 4
+  store volatile i32 3, ptr @g, align 4
+  store volatile i32 4, ptr @g, align 4
+  ret void
+}
+
+attributes #0 = { noredzone nounwind }
+
+;--- b.ll
+@g = global i32 0
+@h = global i32 0
+
+define void @other() #0 {
+  store volatile i32 5, ptr @h, align 4
+  ret void
+}
+
+define void @b3() #0 {
+  store volatile i32 1, ptr @g, align 4
+  store volatile i32 2, ptr @g, align 4
+  store volatile i32 3, ptr @g, align 4
+  store volatile i32 4, ptr @g, align 4
+  ret void
+}
+
+define void @b1() #0 {
+  store volatile i32 1, ptr @g, align 4
+  store volatile i32 2, ptr @g, align 4
+  store volatile i32 3, ptr @g, align 4
+  store volatile i32 4, ptr @g, align 4
+  ret void
+}
+
+define void @b2() #0 {
+  store volatile i32 1, ptr @g, align 4
+  store volatile i32 2, ptr @g, align 4
+  store volatile i32 3, ptr @g, align 4
+  store volatile i32 4, ptr @g, align 4
+  ret void
+}
+
+attributes #0 = { noredzone nounwind }
@@ -0,0 +1,85 @@
+## Instructions are encoded straight into the current data fragment. Check the
+## bytes of every instruction and that each fixup lands at its instruction's
+## offset in the fragment, not at its offset within the instruction.
+
+# RUN: llvm-mc -filetype=obj -triple x86_64-pc-linux-gnu %s -o %t.o
+# RUN: llvm-readobj -x .text %t.o | FileCheck %s --check-prefix=BYTES
+# RUN: llvm-readobj -r %t.o | FileCheck %s --check-prefix=RELOCS
+
+# BYTES:      Hex dump of section '.text':
+# BYTES-NEXT: 0x00000000 53488b05 00000000 8b0d0000 00008305
+# BYTES-NEXT: 0x00000010 00000000 01488d3d 00000000 e8000000
+# BYTES-NEXT: 0x00000020 0064488b 04250000 00008b90 00000000
+# BYTES-NEXT: 0x00000030 488b0d00 00000066 488d3d00 00000066
+# BYTES-NEXT: 0x00000040 6648e800 00000085 c0740f48 be000000
+# BYTES-NEXT: 0x00000050 00000000 00e80000 00005be9 00000000
+# BYTES-NEXT: 0x00000060 b8000000 00ff24c5 00000000 c3{{ }}
+# BYTES-NOT:  0x
+
+# RELOCS:      Section ({{[0-9]+}}) .rela.text {
+# RELOCS-NEXT:   0x4 R_X86_64_REX_GOTPCRELX ext 0xFFFFFFFFFFFFFFFC
+# RELOCS-NEXT:   0xA R_X86_64_PC32 .data 0xFFFFFFFFFFFFFFFC
+# RELOCS-NEXT:   0x10 R_X86_64_PC32 ext2 0xFFFFFFFFFFFFFFFF
+# RELOCS-NEXT:   0x18 R_X86_64_PC32 .rodata 0xC
+# RELOCS-NEXT:   0x1D R_X86_64_PLT32 puts 0xFFFFFFFFFFFFFFFC
+# RELOCS-NEXT:   0x2C R_X86_64_TPOFF32 tvar{{$}}
+# RELOCS-NEXT:   0x33 R_X86_64_GOTTPOFF tvar2 0xFFFFFFFFFFFFFFFC
+# RELOCS-NEXT:   0x3B R_X86_64_TLSGD tvar3 0xFFFFFFFFFFFFFFFC
+# RELOCS-NEXT:   0x43 R_X86_64_PLT32 __tls_get_addr 0xFFFFFFFFFFFFFFFC
+# RELOCS-NEXT:   0x4D R_X86_64_64 ext{{$}}
+# RELOCS-NEXT:   0x56 R_X86_64_PLT32 f 0xFFFFFFFFFFFFFFFC
+# RELOCS-NEXT:   0x5C R_X86_64_PLT32 ext3 0xFFFFFFFFFFFFFFFC
+# RELOCS-NEXT:   0x61 R_X86_64_32 .data{{$}}
+# RELOCS-NEXT:   0x68 R_X86_64_32S .rodata{{$}}
+# RELOCS-NEXT: }
+# RELOCS-NEXT: Section ({{[0-9]+}}) .rela.data {
+# RELOCS-NEXT:   0x4 R_X86_64_64 f{{$}}
+# RELOCS-NEXT:   0xC R_X86_64_PC32 ext{{$}}
+# RELOCS-NEXT: }
+# RELOCS-NEXT: Section ({{[0-9]+}}) .rela.rodata {
+# RELOCS-NEXT:   0x0 R_X86_64_64 .text 0x5A
+# RELOCS-NEXT:   0x8 R_X86_64_64 .text 0x60
+# RELOCS-NEXT: }
+
+  .text
+  .globl f
+  .type f,@function
+f:
+  pushq %rbx
+  movq ext@GOTPCREL(%rip), %rax
+  movl local(%rip), %ecx
+  addl $1, ext2+4(%rip)
+  leaq .Lstr(%rip), %rdi
+  call puts@PLT
+  movq %fs:0, %rax
+  movl tvar@TPOFF(%rax), %edx
+  movq tvar2@GOTTPOFF(%rip), %rcx
+  data16 leaq tvar3@TLSGD(%rip), %rdi
+  data16 data16 rex64 call __tls_get_addr@PLT
+  testl %eax, %eax
+  je .Lout
+  movabsq $ext, %rsi
+  call f
+.Lout:
+  popq %rbx
+  jmp ext3
+  .size f, .-f
+
+  .p2align 4
+g:
+  movl $local, %eax
+  jmp *.Ltable(,%rax,8)
+  ret
+
+  .data
+local:
+  .long 42
+  .quad f
+  .long ext - .
+
+  .section .rodata,"a",@progbits
+.Ltable:
+  .quad .Lout
+  .quad g
+.Lstr:
+  .asciz "hello"
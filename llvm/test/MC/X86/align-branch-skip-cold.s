@@ -0,0 +1,41 @@
+# RUN: llvm-mc -filetype=obj -triple x86_64-unknown-unknown --x86-align-branch-boundary=32 --x86-align-branch=jmp %s | llvm-objdump -d --no-show-raw-insn - | FileCheck %s --check-prefixes=CHECK,PAD
+# RUN: llvm-mc -filetype=obj -triple x86_64-unknown-unknown --x86-align-branch-boundary=32 --x86-align-branch=jmp --x86-align-branch-skip-cold %s | llvm-objdump -d --no-show-raw-insn - | FileCheck %s --check-prefixes=CHECK,SKIP
+
+  ## Check that with --x86-align-branch-skip-cold branches in .text.unlikely*
+  ## and .text.split* sections are not padded, while other text sections
+  ## still are.
+
+# CHECK-LABEL: <hot>:
+# CHECK:         1e: int3
+# CHECK-NEXT:    1f: nop
+# CHECK-NEXT:    20: jmp
+  .text
+hot:
+  .rept 31
+  int3
+  .endr
+  jmp hot
+
+# CHECK-LABEL: <unlikely>:
+# CHECK:         1e: int3
+# PAD-NEXT:      1f: nop
+# PAD-NEXT:      20: jmp
+# SKIP-NEXT:     1f: jmp
+  .section .text.unlikely.foo,"ax",@progbits
+unlikely:
+  .rept 31
+  int3
+  .endr
+  jmp unlikely
+
+# CHECK-LABEL: <split>:
+# CHECK:         1e: int3
+# PAD-NEXT:      1f: nop
+# PAD-NEXT:      20: jmp
+# SKIP-NEXT:     1f: jmp
+  .section .text.split.foo,"ax",@progbits
+split:
+  .rept 31
+  int3
+  .endr
+  jmp split
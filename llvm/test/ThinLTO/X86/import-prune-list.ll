@@ -0,0 +1,56 @@
+; Check that functions named in -thinlto-import-prune-list, by name or by
+; decimal GUID, are not imported, while other candidates still are.
+
+; RUN: rm -rf %t && split-file %s %t
+; RUN: opt -module-summary %t/main.ll -o %t/main.bc
+; RUN: opt -module-summary %t/lib.ll -o %t/lib.bc
+; RUN: llvm-lto -thinlto-action=thinlink -o %t/index.bc %t/main.bc %t/lib.bc
+
+; RUN: opt -passes=function-import -print-imports -summary-file %t/index.bc \
+; RUN:   %t/main.bc -o /dev/null 2>&1 | FileCheck %s --check-prefix=ALL
+; ALL-DAG: Import kept from
+; ALL-DAG: Import pruned_by_name from
+; ALL-DAG: Import pruned_by_guid from
+
+; RUN: opt -passes=function-import -print-imports \
+; RUN:   -thinlto-import-prune-list=%t/prune.txt -summary-file %t/index.bc \
+; RUN:   %t/main.bc -o /dev/null 2>&1 | FileCheck %s --check-prefix=PRUNED
+; PRUNED-NOT: Import pruned_by
+; PRUNED:     Import kept from
+; PRUNED-NOT: Import pruned_by
+
+; The GUID is that of pruned_by_guid.
+;--- prune.txt
+pruned_by_name
+10957532180847523344
+
+;--- main.ll
+target datalayout = "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-f80:128-n8:16:32:64-S128"
+target triple = "x86_64-unknown-linux-gnu"
+
+define void @main() {
+  call void @kept()
+  call void @pruned_by_name()
+  call void @pruned_by_guid()
+  ret void
+}
+
+declare void @kept()
+declare void @pruned_by_name()
+declare void @pruned_by_guid()
+
+;--- lib.ll
+target datalayout = "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-f80:128-n8:16:32:64-S128"
+target triple = "x86_64-unknown-linux-gnu"
+
+define void @kept() {
+  ret void
+}
+
+define void @pruned_by_name() {
+  ret void
+}
+
+define void @pruned_by_guid() {
+  ret void
+}
@@ -0,0 +1,39 @@
+; RUN: opt -passes='instcombine<max-iterations=3>' -disable-output \
+; RUN:   -pass-remarks-analysis=instcombine -pass-remarks-output=%t.yaml \
+; RUN:   < %s 2>&1 | FileCheck %s
+; RUN: FileCheck %s --check-prefix=YAML < %t.yaml
+; RUN: opt -passes='instcombine<no-verify-fixpoint>' -disable-output \
+; RUN:   -pass-remarks-analysis=instcombine < %s 2>&1 \
+; RUN:   | FileCheck %s --check-prefix=ONE --allow-empty
+
+; A function that is changed takes a second iteration to find that nothing
+; is left to combine, which is reported. A function that needs a single
+; iteration is not reported, and neither is any function when, as in the
+; default pipelines, the pass stops after one iteration without verifying
+; the fixpoint.
+
+; CHECK:     remark: <unknown>:0:0: ran 2 iterations over the function
+; CHECK-NOT: remark:
+
+; YAML:      --- !Analysis
+; YAML-NEXT: Pass:            instcombine
+; YAML-NEXT: Name:            Iterations
+; YAML-NEXT: Function:        changed
+; YAML-NEXT: Args:
+; YAML-NEXT:   - String:          'ran '
+; YAML-NEXT:   - Iterations:      '2'
+; YAML-NEXT:   - String:          ' iterations over the function'
+; YAML-NEXT: ...
+; YAML-NOT:  --- !Analysis
+
+; ONE-NOT: remark:
+
+define i32 @changed(i32 %x) {
+  %a = add i32 %x, 0
+  ret i32 %a
+}
+
+define i32 @unchanged(i32 %x, i32 %y) {
+  %a = add i32 %x, %y
+  ret i32 %a
+}
@@ -0,0 +1,50 @@
+; RUN: opt -passes=slp-vectorizer -mtriple=x86_64-unknown-linux-gnu -S < %s \
+; RUN:   | FileCheck %s --check-prefix=FULL
+; RUN: opt -passes=slp-vectorizer -mtriple=x86_64-unknown-linux-gnu -S \
+; RUN:   -slp-tree-node-budget=1 -pass-remarks-missed=slp-vectorizer < %s 2>&1 \
+; RUN:   | FileCheck %s --check-prefix=BUDGET
+
+; Without a budget the stores, the adds and both groups of loads form one
+; tree and are vectorized. With a budget of one tree node only the stores
+; are built, the adds are gathered, and the tree is no longer profitable.
+
+; BUDGET: remark: <unknown>:0:0: SLP vectorization stopped building trees after 1 tree nodes; the remaining bundles were gathered
+
+; FULL-LABEL: @add4(
+; FULL:         load <4 x i32>
+; FULL:         load <4 x i32>
+; FULL:         add <4 x i32>
+; FULL:         store <4 x i32>
+
+; BUDGET-LABEL: @add4(
+; BUDGET-NOT:     <4 x i32>
+; BUDGET:         ret void
+
+define void @add4(ptr %a, ptr %b, ptr %c) {
+  %a1 = getelementptr inbounds i32, ptr %a, i64 1
+  %a2 = getelementptr inbounds i32, ptr %a, i64 2
+  %a3 = getelementptr inbounds i32, ptr %a, i64 3
+  %b1 = getelementptr inbounds i32, ptr %b, i64 1
+  %b2 = getelementptr inbounds i32, ptr %b, i64 2
+  %b3 = getelementptr inbounds i32, ptr %b, i64 3
+  %c1 = getelementptr inbounds i32, ptr %c, i64 1
+  %c2 = getelementptr inbounds i32, ptr %c, i64 2
+  %c3 = getelementptr inbounds i32, ptr %c, i64 3
+  %la0 = load i32, ptr %a, align 4
+  %la1 = load i32, ptr %a1, align 4
+  %la2 = load i32, ptr %a2, align 4
+  %la3 = load i32, ptr %a3, align 4
+  %lb0 = load i32, ptr %b, align 4
+  %lb1 = load i32, ptr %b1, align 4
+  %lb2 = load i32, ptr %b2, align 4
+  %lb3 = load i32, ptr %b3, align 4
+  %s0 = add i32 %la0, %lb0
+  %s1 = add i32 %la1, %lb1
+  %s2 = add i32 %la2, %lb2
+  %s3 = add i32 %la3, %lb3
+  store i32 %s0, ptr %c, align 4
+  store i32 %s1, ptr %c1, align 4
+  store i32 %s2, ptr %c2, align 4
+  store i32 %s3, ptr %c3, align 4
+  ret void
+}
@@ -0,0 +1,84 @@
+; Check that -split-module-by-call-graph keeps each group of functions that
+; call each other whole in one partition. Which group lands in which
+; partition is up to the ordering, so the checks only require that each
+; partition defines all functions of a single group.
+
+; RUN: llvm-split -split-module-by-call-graph -j 2 -o %t %s
+; RUN: llvm-dis -o - %t0 | FileCheck --check-prefix=CHECK0 %s
+; RUN: llvm-dis -o - %t1 | FileCheck --check-prefix=CHECK1 %s
+
+; CHECK0-NOT: define
+; CHECK0: define void @[[G0:a|b]]1()
+; CHECK0-NOT: define
+; CHECK0: define void @[[G0]]2()
+; CHECK0-NOT: define
+; CHECK0: define void @[[G0]]3()
+; CHECK0-NOT: define
+; CHECK0: define void @[[G0]]4()
+; CHECK0-NOT: define
+
+; CHECK1-NOT: define
+; CHECK1: define void @[[G1:a|b]]1()
+; CHECK1-NOT: define
+; CHECK1: define void @[[G1]]2()
+; CHECK1-NOT: define
+; CHECK1: define void @[[G1]]3()
+; CHECK1-NOT: define
+; CHECK1: define void @[[G1]]4()
+; CHECK1-NOT: define
+
+define void @a1() {
+  call void @a2()
+  call void @a3()
+  call void @a4()
+  ret void
+}
+
+define void @b1() {
+  call void @b2()
+  call void @b3()
+  call void @b4()
+  ret void
+}
+
+define void @a2() {
+  call void @a1()
+  call void @a3()
+  call void @a4()
+  ret void
+}
+
+define void @b2() {
+  call void @b1()
+  call void @b3()
+  call void @b4()
+  ret void
+}
+
+define void @a3() {
+  call void @a1()
+  call void @a2()
+  call void @a4()
+  ret void
+}
+
+define void @b3() {
+  call void @b1()
+  call void @b2()
+  call void @b4()
+  ret void
+}
+
+define void @a4() {
+  call void @a1()
+  call void @a2()
+  call void @a3()
+  ret void
+}
+
+define void @b4() {
+  call void @b1()
+  call void @b2()
+  call void @b3()
+  ret void
+}
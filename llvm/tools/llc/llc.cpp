@@ -93,6 +93,12 @@ static cl::opt<unsigned> TimeTraceGranularity(
         "Minimum time granularity (in microseconds) traced by time profiler"),
     cl::init(500), cl::Hidden);
 
+static cl::opt<bool> TimeTraceSummary(
+    "time-trace-summary",
+    cl::desc("Only aggregate time trace entries into a call tree, and print "
+             "it to stderr in addition to writing the time trace file"),
+    cl::Hidden);
+
 static cl::opt<std::string>
     TimeTraceFile("time-trace-file",
                   cl::desc("Specify time trace file destination"),
@@ -372,9 +378,14 @@ int main(int argc, char **argv) {
   }
 
   if (TimeTrace)
-    timeTraceProfilerInitialize(TimeTraceGranularity, argv[0]);
+    timeTraceProfilerInitialize(TimeTraceGranularity, argv[0],
+                                TimeTraceSummary
+                                    ? TimeTraceProfilerMode::Summary
+                                    : TimeTraceProfilerMode::Events);
   auto TimeTraceScopeExit = make_scope_exit([]() {
     if (TimeTrace) {
+      if (TimeTraceSummary)
+        timeTraceProfilerWriteSummary(errs());
       if (auto E = timeTraceProfilerWrite(TimeTraceFile, OutputFilename)) {
         handleAllErrors(std::move(E), [&](const StringError &SE) {
           errs() << SE.getMessage() << "\n";
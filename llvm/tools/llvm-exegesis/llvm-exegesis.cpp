@@ -9,6 +9,13 @@
 /// \file
 /// Measures execution properties (latencies/uops) of an instruction.
 ///
+/// To validate a whole scheduling model, measure every opcode with
+/// --opcode-index=-1 and feed the results to --mode=analysis with
+/// --analysis-inconsistencies-output-file, which reports where measurements
+/// disagree with the model. Measurements run one at a time on purpose;
+/// snippets running concurrently on sibling cores would perturb each other's
+/// counters, so pin the process to a quiet core (e.g. with taskset) instead.
+///
 //===----------------------------------------------------------------------===//
 
 #include "lib/Analysis.h"
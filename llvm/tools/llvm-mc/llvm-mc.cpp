@@ -489,9 +489,23 @@ int main(int argc, char **argv) {
   sys::fs::OpenFlags Flags = (FileType == OFT_AssemblyFile)
                                  ? sys::fs::OF_TextWithCRLF
                                  : sys::fs::OF_None;
-  std::unique_ptr<ToolOutputFile> Out = GetOutputStream(OutputFilename, Flags);
-  if (!Out)
-    return 1;
+  // Assembled object files are written through a memory-mapped temporary
+  // file when possible, which saves copying them through a stream buffer.
+  std::unique_ptr<raw_mmap_ostream> MmapOut;
+  if (FileType == OFT_ObjectFile && Action == AC_Assemble) {
+    Expected<std::unique_ptr<raw_mmap_ostream>> MmapOutOrErr =
+        raw_mmap_ostream::create(OutputFilename);
+    if (MmapOutOrErr)
+      MmapOut = std::move(*MmapOutOrErr);
+    else
+      consumeError(MmapOutOrErr.takeError());
+  }
+  std::unique_ptr<ToolOutputFile> Out;
+  if (!MmapOut) {
+    Out = GetOutputStream(OutputFilename, Flags);
+    if (!Out)
+      return 1;
+  }
 
   std::unique_ptr<ToolOutputFile> DwoOut;
   if (!SplitDwarfFile.empty()) {
@@ -505,7 +519,9 @@ int main(int argc, char **argv) {
   }
 
   std::unique_ptr<buffer_ostream> BOS;
-  raw_pwrite_stream *OS = &Out->os();
+  raw_pwrite_stream *OS = MmapOut.get();
+  if (!OS)
+    OS = &Out->os();
   std::unique_ptr<MCStreamer> Str;
 
   std::unique_ptr<MCInstrInfo> MCII(TheTarget->createMCInstrInfo());
@@ -551,7 +567,7 @@ int main(int argc, char **argv) {
   } else {
     assert(FileType == OFT_ObjectFile && "Invalid file type!");
 
-    if (!Out->os().supportsSeeking()) {
+    if (Out && !Out->os().supportsSeeking()) {
       BOS = std::make_unique<buffer_ostream>(Out->os());
       OS = BOS.get();
     }
@@ -600,7 +616,14 @@ int main(int argc, char **argv) {
 
   // Keep output if no errors.
   if (Res == 0) {
-    Out->keep();
+    if (MmapOut) {
+      if (Error E = MmapOut->commit()) {
+        WithColor::error() << toString(std::move(E)) << '\n';
+        return 1;
+      }
+    } else {
+      Out->keep();
+    }
     if (DwoOut)
       DwoOut->keep();
   }
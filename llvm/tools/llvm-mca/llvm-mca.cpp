@@ -18,6 +18,13 @@
 // The cpu defaults to the 'native' host cpu.
 // The output defaults to standard output.
 //
+// Each code region is simulated on its own as if it were the body of a loop
+// that runs for -iterations iterations. Branches inside a region are treated
+// like any other instruction: control flow, taken-branch frontend costs and
+// the relative weight of regions are not modelled. To look at a hot loop
+// nest, mark each hot block as its own region and weight the reports using
+// profile data outside of llvm-mca.
+//
 //===----------------------------------------------------------------------===//
 
 #include "CodeRegion.h"
@@ -913,7 +913,11 @@ static void mergeInstrProfile(const WeightedFileVector &Inputs,
     NumThreads = std::min(hardware_concurrency().compute_thread_count(),
                           unsigned((Inputs.size() + 1) / 2));
 
-  // Initialize the writer contexts.
+  // Initialize the writer contexts. Each context ends up holding every
+  // function seen in its share of the inputs, so peak memory grows with
+  // NumThreads times the size of the merged profile rather than with the
+  // number of inputs. To bound memory on very large merges, lower -j, or
+  // merge the inputs in batches into indexed profiles and merge those.
   SmallVector<std::unique_ptr<WriterContext>, 4> Contexts;
   for (unsigned I = 0; I < NumThreads; ++I)
     Contexts.emplace_back(std::make_unique<WriterContext>(
@@ -0,0 +1,144 @@
+//===- unittest/ADT/CompactMapVectorTest.cpp - CompactMapVector unit tests ===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#include "llvm/ADT/CompactMapVector.h"
+#include "llvm/ADT/DenseMap.h"
+#include "gtest/gtest.h"
+#include <memory>
+#include <random>
+#include <utility>
+
+using namespace llvm;
+
+namespace {
+
+TEST(CompactMapVectorTest, Insertion) {
+  CompactMapVector<int, int> MV;
+  std::pair<CompactMapVector<int, int>::iterator, bool> R;
+
+  R = MV.insert(std::make_pair(1, 2));
+  ASSERT_EQ(R.first, MV.begin());
+  EXPECT_EQ(R.first->first, 1);
+  EXPECT_EQ(R.first->second, 2);
+  EXPECT_TRUE(R.second);
+
+  R = MV.insert(std::make_pair(1, 3));
+  ASSERT_EQ(R.first, MV.begin());
+  EXPECT_EQ(R.first->second, 2);
+  EXPECT_FALSE(R.second);
+
+  R = MV.insert(std::make_pair(4, 5));
+  ASSERT_NE(R.first, MV.end());
+  EXPECT_EQ(R.first->first, 4);
+  EXPECT_EQ(R.first->second, 5);
+  EXPECT_TRUE(R.second);
+
+  EXPECT_EQ(MV.size(), 2u);
+  EXPECT_EQ(MV[1], 2);
+  EXPECT_EQ(MV[4], 5);
+  EXPECT_EQ(MV.lookup(1), 2);
+  EXPECT_EQ(MV.lookup(2), 0);
+  EXPECT_TRUE(MV.contains(4));
+  EXPECT_FALSE(MV.contains(3));
+
+  MV.pop_back();
+  EXPECT_EQ(MV.size(), 1u);
+  EXPECT_EQ(MV.find(4), MV.end());
+  EXPECT_EQ(MV.lookup(1), 2);
+
+  MV.clear();
+  EXPECT_TRUE(MV.empty());
+  EXPECT_FALSE(MV.contains(1));
+}
+
+TEST(CompactMapVectorTest, MoveOnlyValues) {
+  CompactMapVector<int, std::unique_ptr<int>> MV;
+  auto [It, Inserted] = MV.try_emplace(1, std::make_unique<int>(3));
+  EXPECT_TRUE(Inserted);
+  EXPECT_EQ(*It->second, 3);
+  MV.insert_or_assign(1, std::make_unique<int>(4));
+  EXPECT_EQ(*MV.find(1)->second, 4);
+
+  CompactMapVector<int, std::unique_ptr<int>> Moved(std::move(MV));
+  EXPECT_EQ(Moved.size(), 1u);
+  EXPECT_TRUE(MV.empty());
+  EXPECT_FALSE(MV.contains(1));
+}
+
+TEST(CompactMapVectorTest, Erase) {
+  CompactMapVector<int, int> MV;
+  for (int I = 0; I < 6; ++I)
+    MV[I] = I * 10;
+
+  auto It = MV.erase(MV.find(2));
+  EXPECT_EQ(It->first, 3);
+  EXPECT_EQ(MV.erase(5), 1u);
+  EXPECT_EQ(MV.erase(5), 0u);
+
+  EXPECT_EQ(MV.size(), 4u);
+  int Expected[] = {0, 1, 3, 4};
+  unsigned Idx = 0;
+  for (const auto &[Key, Val] : MV) {
+    EXPECT_EQ(Key, Expected[Idx++]);
+    EXPECT_EQ(Val, Key * 10);
+    EXPECT_EQ(MV.lookup(Key), Key * 10);
+  }
+
+  MV.remove_if([](const std::pair<int, int> &KV) { return KV.first % 2; });
+  EXPECT_EQ(MV.size(), 2u);
+  EXPECT_EQ(MV.begin()->first, 0);
+  EXPECT_EQ(MV.back().first, 4);
+  EXPECT_FALSE(MV.contains(1));
+  EXPECT_EQ(MV.lookup(4), 40);
+}
+
+TEST(CompactMapVectorTest, Copy) {
+  CompactMapVector<int, int> MV;
+  MV.reserve(10);
+  for (int I = 0; I < 10; ++I)
+    MV[I] = I;
+  CompactMapVector<int, int> Copy(MV);
+  ASSERT_EQ(Copy.size(), 10u);
+  for (int I = 0; I < 10; ++I)
+    EXPECT_EQ(Copy.lookup(I), I);
+  Copy = CompactMapVector<int, int>();
+  EXPECT_TRUE(Copy.empty());
+  EXPECT_EQ(MV.lookup(9), 9);
+}
+
+// Keep the map in sync with a DenseMap through many inserts, erases and
+// pop_backs, which exercises tombstones and rebuilding the index table.
+TEST(CompactMapVectorTest, RandomOperations) {
+  std::mt19937 Rng(7);
+  CompactMapVector<int *, unsigned> MV;
+  DenseMap<int *, unsigned> Ref;
+  int Storage[512];
+  for (unsigned I = 0; I < 20000; ++I) {
+    int *Key = &Storage[Rng() % 512];
+    switch (Rng() % 8) {
+    case 0:
+      EXPECT_EQ(Ref.erase(Key), MV.erase(Key) != 0);
+      break;
+    case 1:
+      if (!MV.empty()) {
+        Ref.erase(MV.back().first);
+        MV.pop_back();
+      }
+      break;
+    default:
+      Ref[Key] = I;
+      MV[Key] = I;
+      break;
+    }
+  }
+  EXPECT_EQ(Ref.size(), MV.size());
+  for (const auto &[Key, Val] : Ref)
+    EXPECT_EQ(Val, MV.lookup(Key));
+}
+
+} // end anonymous namespace
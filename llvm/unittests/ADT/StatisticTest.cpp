@@ -9,6 +9,8 @@
 #include "llvm/ADT/Statistic.h"
 #include "llvm/Support/raw_ostream.h"
 #include "gtest/gtest.h"
+#include <future>
+#include <thread>
 using namespace llvm;
 
 using OptionalStatistic = std::optional<std::pair<StringRef, uint64_t>>;
@@ -18,6 +20,7 @@ namespace {
 STATISTIC(Counter, "Counts things");
 STATISTIC(Counter2, "Counts other things");
 ALWAYS_ENABLED_STATISTIC(AlwaysCounter, "Counts things always");
+ALWAYS_ENABLED_STATISTIC(ThreadedCounter, "Counts things on many threads");
 
 #if LLVM_ENABLE_STATS
 static void
@@ -169,4 +172,45 @@ TEST(StatisticTest, API) {
 #endif
 }
 
+// Increments from other threads must be visible both while those threads are
+// running and after they have exited.
+TEST(StatisticTest, Threads) {
+  ThreadedCounter = 0;
+  ++ThreadedCounter;
+
+  constexpr unsigned NumThreads = 4, NumIncrements = 1000;
+  std::promise<void> Done;
+  std::shared_future<void> DoneFuture = Done.get_future().share();
+  std::vector<std::promise<void>> Counted(NumThreads);
+  std::vector<std::thread> Threads;
+  for (unsigned I = 0; I < NumThreads; ++I)
+    Threads.emplace_back([&, I] {
+      for (unsigned J = 0; J < NumIncrements; ++J)
+        ++ThreadedCounter;
+      ThreadedCounter += 2;
+      --ThreadedCounter;
+      Counted[I].set_value();
+      DoneFuture.wait();
+    });
+  for (std::promise<void> &P : Counted)
+    P.get_future().wait();
+
+  const uint64_t Expected = 1 + NumThreads * (NumIncrements + 1);
+  EXPECT_EQ(ThreadedCounter, Expected);
+
+  Done.set_value();
+  for (std::thread &T : Threads)
+    T.join();
+  EXPECT_EQ(ThreadedCounter, Expected);
+
+  // A new thread reuses the counters of one that exited.
+  std::thread([] { ++ThreadedCounter; }).join();
+  EXPECT_EQ(ThreadedCounter, Expected + 1);
+
+  ThreadedCounter = 5;
+  EXPECT_EQ(ThreadedCounter, 5u);
+  EXPECT_EQ(ThreadedCounter++, 5u);
+  EXPECT_EQ(ThreadedCounter, 6u);
+}
+
 } // end anonymous namespace
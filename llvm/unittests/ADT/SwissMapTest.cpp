@@ -0,0 +1,122 @@
+//===- llvm/unittest/ADT/SwissMapTest.cpp - SwissMap unit tests -----------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#include "llvm/ADT/SwissMap.h"
+#include "llvm/ADT/StringRef.h"
+#include "gtest/gtest.h"
+#include <map>
+#include <random>
+#include <string>
+
+using namespace llvm;
+
+namespace {
+
+TEST(SwissMapTest, EmptyMap) {
+  SwissMap<int, int> M;
+  EXPECT_TRUE(M.empty());
+  EXPECT_EQ(0u, M.size());
+  EXPECT_TRUE(M.begin() == M.end());
+  EXPECT_FALSE(M.contains(1));
+  EXPECT_TRUE(M.find(1) == M.end());
+  EXPECT_EQ(0, M.lookup(1));
+  EXPECT_FALSE(M.erase(1));
+}
+
+TEST(SwissMapTest, InsertFindErase) {
+  SwissMap<unsigned, unsigned> M;
+  auto [It, Inserted] = M.try_emplace(1u, 2u);
+  EXPECT_TRUE(Inserted);
+  EXPECT_EQ(1u, It->first);
+  EXPECT_EQ(2u, It->second);
+  EXPECT_FALSE(M.insert({1, 3}).second);
+  EXPECT_EQ(2u, M.at(1));
+  M[4] = 5;
+  EXPECT_EQ(2u, M.size());
+  EXPECT_EQ(1u, M.count(4));
+  EXPECT_EQ(5u, M.find(4)->second);
+
+  M.insert_or_assign(4u, 6u);
+  EXPECT_EQ(6u, M.lookup(4));
+
+  EXPECT_TRUE(M.erase(1));
+  EXPECT_FALSE(M.contains(1));
+  M.erase(M.find(4));
+  EXPECT_TRUE(M.empty());
+}
+
+TEST(SwissMapTest, CopyMoveAndClear) {
+  SwissMap<int, std::string> M = {{1, "one"}, {2, "two"}};
+  SwissMap<int, std::string> Copy(M);
+  EXPECT_EQ(2u, Copy.size());
+  EXPECT_EQ("two", Copy.lookup(2));
+
+  SwissMap<int, std::string> Moved(std::move(M));
+  EXPECT_EQ("one", Moved.lookup(1));
+
+  Copy.clear();
+  EXPECT_TRUE(Copy.empty());
+  EXPECT_FALSE(Copy.contains(1));
+  Copy = Moved;
+  EXPECT_EQ("one", Copy.lookup(1));
+
+  unsigned Count = 0;
+  for (const auto &KV : Copy) {
+    EXPECT_EQ(KV.second, Moved.lookup(KV.first));
+    ++Count;
+  }
+  EXPECT_EQ(2u, Count);
+}
+
+TEST(SwissMapTest, StringRefKeys) {
+  SwissMap<StringRef, unsigned> M;
+  std::vector<std::string> Strings;
+  for (unsigned I = 0; I < 1000; ++I)
+    Strings.push_back("symbol" + std::to_string(I));
+  for (unsigned I = 0; I < 1000; ++I)
+    M[Strings[I]] = I;
+  for (unsigned I = 0; I < 1000; ++I)
+    EXPECT_EQ(I, M.lookup(Strings[I]));
+  EXPECT_FALSE(M.contains("symbol1000"));
+}
+
+// Compare against std::map with many inserts and erases, which exercises
+// growing, rehashing away deleted buckets and probing across groups.
+TEST(SwissMapTest, RandomOperations) {
+  std::mt19937 Rng(42);
+  SwissMap<uint32_t, uint32_t> M;
+  std::map<uint32_t, uint32_t> Ref;
+  for (unsigned I = 0; I < 100000; ++I) {
+    uint32_t Key = Rng() % 5000;
+    if (Rng() % 3 == 0) {
+      EXPECT_EQ(Ref.erase(Key) != 0, M.erase(Key));
+    } else {
+      Ref[Key] = I;
+      M[Key] = I;
+    }
+  }
+  EXPECT_EQ(Ref.size(), M.size());
+  for (const auto &[Key, Val] : Ref)
+    EXPECT_EQ(Val, M.lookup(Key));
+  unsigned Count = 0;
+  for (const auto &KV : M) {
+    EXPECT_EQ(Ref[KV.first], KV.second);
+    ++Count;
+  }
+  EXPECT_EQ(Ref.size(), Count);
+}
+
+TEST(SwissMapTest, Reserve) {
+  SwissMap<int, int> M(100);
+  size_t Size = M.getMemorySize();
+  for (int I = 0; I < 100; ++I)
+    M[I] = I;
+  EXPECT_EQ(Size, M.getMemorySize());
+}
+
+} // namespace
@@ -296,6 +296,42 @@ TEST_F(AliasAnalysisTest, BatchAAPhiAssumption) {
   EXPECT_EQ(AliasResult::MayAlias, BatchAA.alias(ANextLoc, BNextLoc));
 }
 
+TEST_F(AliasAnalysisTest, BatchAASharedLocation) {
+  LLVMContext C;
+  SMDiagnostic Err;
+  std::unique_ptr<Module> M = parseAssemblyString(R"(
+    define void @f(ptr noalias %a, ptr %b, i64 %i) {
+      %a0 = getelementptr i8, ptr %a, i64 0
+      %a1 = getelementptr i8, ptr %a, i64 1
+      %ai = getelementptr i8, ptr %a, i64 %i
+      ret void
+    }
+  )", Err, C);
+
+  Function *F = M->getFunction("f");
+  Instruction *A0 = getInstructionByName(*F, "a0");
+  Instruction *A1 = getInstructionByName(*F, "a1");
+  Instruction *AI = getInstructionByName(*F, "ai");
+  MemoryLocation A0Loc(A0, LocationSize::precise(1));
+  MemoryLocation Locs[] = {
+      MemoryLocation(A0, LocationSize::precise(1)),
+      MemoryLocation(A1, LocationSize::precise(1)),
+      MemoryLocation(AI, LocationSize::precise(1)),
+      MemoryLocation(F->getArg(1), LocationSize::precise(1))};
+
+  auto &AA = getAAResults(*F);
+  BatchAAResults BatchAA(AA);
+  SmallVector<AliasResult, 4> Results;
+  for (const MemoryLocation &Loc : Locs)
+    Results.push_back(BatchAA.alias(A0Loc, Loc));
+  EXPECT_EQ(AliasResult::MustAlias, Results[0]);
+  EXPECT_EQ(AliasResult::NoAlias, Results[1]);
+  EXPECT_EQ(AliasResult::MayAlias, Results[2]);
+  EXPECT_EQ(AliasResult::NoAlias, Results[3]);
+  for (unsigned I = 0; I < 4; ++I)
+    EXPECT_EQ(AA.alias(A0Loc, Locs[I]), Results[I]);
+}
+
 // Check that two aliased GEPs with non-constant offsets are correctly
 // analyzed and their relative offset can be requested from AA.
 TEST_F(AliasAnalysisTest, PartialAliasOffset) {
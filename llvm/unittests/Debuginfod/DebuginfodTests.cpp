@@ -7,11 +7,16 @@
 //===----------------------------------------------------------------------===//
 
 #include "llvm/Debuginfod/Debuginfod.h"
+#include "llvm/ADT/StringExtras.h"
 #include "llvm/Debuginfod/HTTPClient.h"
+#include "llvm/Debuginfod/HTTPServer.h"
 #include "llvm/Support/FileSystem.h"
+#include "llvm/Support/MemoryBuffer.h"
 #include "llvm/Support/Path.h"
+#include "llvm/Support/ThreadPool.h"
 #include "llvm/Testing/Support/Error.h"
 #include "gtest/gtest.h"
+#include <atomic>
 
 #ifdef _WIN32
 #define setenv(name, var, ignore) _putenv_s(name, var)
@@ -67,3 +72,56 @@ TEST(DebuginfodClient, CacheMiss) {
   // A cache miss with no possible URLs should not create the cache directory.
   EXPECT_FALSE(sys::fs::exists(CacheDir));
 }
+
+#if defined(LLVM_ENABLE_HTTPLIB) && defined(LLVM_ENABLE_CURL)
+// Check that prefetchDebuginfo downloads every artifact the server has into
+// the cache, so that later lookups don't need the server.
+TEST(DebuginfodClient, Prefetch) {
+  SmallString<32> CacheDir;
+  ASSERT_NO_ERROR(
+      sys::fs::createUniqueDirectory("debuginfod-unittest", CacheDir));
+  setenv("DEBUGINFOD_CACHE_PATH", CacheDir.c_str(), /*replace=*/1);
+
+  std::atomic<unsigned> NumRequests = 0;
+  HTTPServer Server;
+  ASSERT_THAT_ERROR(
+      Server.get(R"(/buildid/(.*)/debuginfo)",
+                 [&](HTTPServerRequest &Request) {
+                   ++NumRequests;
+                   if (Request.UrlPathMatches[0] == "0202")
+                     Request.setResponse({404u, "text/plain", "not found\n"});
+                   else
+                     Request.setResponse({200u, "text/plain", "debuginfo\n"});
+                 }),
+      Succeeded());
+  Expected<unsigned> PortOrErr = Server.bind();
+  ASSERT_THAT_EXPECTED(PortOrErr, Succeeded());
+  DefaultThreadPool ServerPool(hardware_concurrency(1));
+  ServerPool.async([&]() { EXPECT_THAT_ERROR(Server.listen(), Succeeded()); });
+
+  std::string Url = "http://localhost:" + utostr(*PortOrErr);
+  setDefaultDebuginfodUrls({Url});
+  HTTPClient::initialize();
+
+  SmallVector<object::BuildID> IDs = {{1, 1}, {2, 2}, {3, 3}};
+  DefaultThreadPool Pool(hardware_concurrency(3));
+  prefetchDebuginfo(IDs, Pool);
+  EXPECT_EQ(3u, NumRequests);
+
+  // Without any servers, only the cache can satisfy the lookups.
+  setDefaultDebuginfodUrls({});
+  for (const object::BuildID &ID : {IDs[0], IDs[2]}) {
+    Expected<std::string> PathOrErr = getCachedOrDownloadDebuginfo(ID);
+    ASSERT_THAT_EXPECTED(PathOrErr, Succeeded());
+    ErrorOr<std::unique_ptr<MemoryBuffer>> BufOrErr =
+        MemoryBuffer::getFile(*PathOrErr);
+    ASSERT_TRUE(bool(BufOrErr));
+    EXPECT_EQ("debuginfo\n", (*BufOrErr)->getBuffer());
+  }
+  EXPECT_THAT_EXPECTED(getCachedOrDownloadDebuginfo(IDs[1]),
+                       Failed<StringError>());
+
+  Server.stop();
+  HTTPClient::cleanup();
+}
+#endif
@@ -167,6 +167,44 @@ TEST(BasicBlockTest, ComesBefore) {
   EXPECT_FALSE(Ret->comesBefore(Ret));
 }
 
+TEST(BasicBlockTest, BlockNumbers) {
+  LLVMContext Ctx;
+  Module M("M", Ctx);
+  FunctionType *FT = FunctionType::get(Type::getVoidTy(Ctx), {}, false);
+  Function *F = Function::Create(FT, Function::ExternalLinkage, "f", M);
+  Function *G = Function::Create(FT, Function::ExternalLinkage, "g", M);
+  EXPECT_EQ(0u, F->getMaxBlockNumber());
+
+  BasicBlock *BB0 = BasicBlock::Create(Ctx, "bb0", F);
+  BasicBlock *BB1 = BasicBlock::Create(Ctx, "bb1", F);
+  BasicBlock *BB2 = BasicBlock::Create(Ctx, "bb2", F, BB0);
+  EXPECT_EQ(0u, BB0->getNumber());
+  EXPECT_EQ(1u, BB1->getNumber());
+  EXPECT_EQ(2u, BB2->getNumber());
+  EXPECT_EQ(3u, F->getMaxBlockNumber());
+
+  // Removing a block leaves a gap, moving it within the function keeps its
+  // number and moving it to another function gives it a new one.
+  BB1->eraseFromParent();
+  BB0->moveBefore(BB2);
+  EXPECT_EQ(0u, BB0->getNumber());
+  EXPECT_EQ(3u, F->getMaxBlockNumber());
+  G->splice(G->end(), F, BB2->getIterator());
+  EXPECT_EQ(0u, BB2->getNumber());
+  EXPECT_EQ(1u, G->getMaxBlockNumber());
+
+  BasicBlock *BB3 = BasicBlock::Create(Ctx, "bb3");
+  BB3->insertInto(F);
+  EXPECT_EQ(3u, BB3->getNumber());
+
+  unsigned Epoch = F->getBlockNumberEpoch();
+  F->renumberBlocks();
+  EXPECT_NE(Epoch, F->getBlockNumberEpoch());
+  EXPECT_EQ(2u, F->getMaxBlockNumber());
+  EXPECT_EQ(0u, BB0->getNumber());
+  EXPECT_EQ(1u, BB3->getNumber());
+}
+
 class InstrOrderInvalidationTest : public ::testing::Test {
 protected:
   void SetUp() override {
@@ -0,0 +1,78 @@
+//===- llvm/unittest/Support/JobserverTest.cpp ----------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#include "llvm/Support/Jobserver.h"
+#include "llvm/Config/llvm-config.h"
+#include "gtest/gtest.h"
+
+#ifdef LLVM_ON_UNIX
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string>
+#include <thread>
+#include <unistd.h>
+#endif
+
+using namespace llvm;
+
+namespace {
+
+#ifdef LLVM_ON_UNIX
+TEST(JobserverTest, PipeTokens) {
+  // This test has to install the jobserver before anything else in the process
+  // asks for it, as the client is created only once.
+  int FDs[2];
+  ASSERT_EQ(pipe(FDs), 0);
+  ASSERT_EQ(write(FDs[1], "ab", 2), 2);
+  std::string MakeFlags = "-j3 --jobserver-auth=" + std::to_string(FDs[0]) +
+                          "," + std::to_string(FDs[1]);
+  ASSERT_EQ(setenv("MAKEFLAGS", MakeFlags.c_str(), 1), 0);
+
+  JobserverClient *Client = JobserverClient::getInstance();
+  ASSERT_NE(Client, nullptr);
+
+  // The implicit slot and the two tokens in the pipe.
+  ASSERT_TRUE(Client->acquire());
+  ASSERT_TRUE(Client->acquire());
+  ASSERT_TRUE(Client->acquire());
+
+  // The pipe is now empty.
+  int Flags = fcntl(FDs[0], F_GETFL);
+  ASSERT_EQ(fcntl(FDs[0], F_SETFL, Flags | O_NONBLOCK), 0);
+  char C;
+  EXPECT_EQ(read(FDs[0], &C, 1), -1);
+  ASSERT_EQ(fcntl(FDs[0], F_SETFL, Flags), 0);
+
+  // Releasing gives the tokens back to the pipe before the implicit slot.
+  Client->release();
+  Client->release();
+  EXPECT_EQ(read(FDs[0], &C, 1), 1);
+  EXPECT_EQ(read(FDs[0], &C, 1), 1);
+  Client->release();
+
+  // A thread waiting for a token takes the implicit slot once it is free.
+  ASSERT_TRUE(Client->acquire());
+  std::thread Waiter([&] {
+    EXPECT_TRUE(Client->acquire());
+    Client->release();
+  });
+  Client->release();
+  Waiter.join();
+
+  {
+    // A nested slot on the same thread doesn't take another token.
+    JobserverSlot Outer;
+    JobserverSlot Inner;
+    JobserverSlot Disabled(/*Enable=*/false);
+  }
+
+  unsetenv("MAKEFLAGS");
+}
+#endif
+
+} // end anonymous namespace
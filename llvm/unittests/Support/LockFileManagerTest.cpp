@@ -8,7 +8,9 @@
 
 #include "llvm/Support/LockFileManager.h"
 #include "llvm/Support/FileSystem.h"
+#include "llvm/Support/MemoryBuffer.h"
 #include "llvm/Support/Path.h"
+#include "llvm/Support/raw_ostream.h"
 #include "llvm/Testing/Support/SupportHelpers.h"
 #include "gtest/gtest.h"
 #include <memory>
@@ -104,4 +106,39 @@ TEST(LockFileManagerTest, RelativePath) {
   ASSERT_FALSE(chdir(OrigPath));
 }
 
+TEST(LockFileManagerTest, IsLocked) {
+  TempDir TmpDir("LockFileManagerTestDir", /*Unique*/ true);
+
+  SmallString<64> LiveFile(TmpDir.path());
+  sys::path::append(LiveFile, "live");
+  SmallString<64> LiveLock(LiveFile);
+  LiveLock += ".lock";
+
+  SmallString<64> StaleFile(TmpDir.path());
+  sys::path::append(StaleFile, "stale");
+  SmallString<64> StaleLock(StaleFile);
+  StaleLock += ".lock";
+
+  EXPECT_FALSE(LockFileManager::isLocked(LiveFile));
+
+  LockFileManager Locked(LiveFile);
+  ASSERT_EQ(LockFileManager::LFS_Owned, Locked.getState());
+  EXPECT_TRUE(LockFileManager::isLocked(LiveFile));
+
+  // Leave a lock behind on this host for a process that no longer exists.
+  auto Buffer = MemoryBuffer::getFile(LiveLock);
+  ASSERT_TRUE(bool(Buffer));
+  StringRef Hostname = (*Buffer)->getBuffer().split(' ').first;
+  {
+    std::error_code EC;
+    raw_fd_ostream Out(StaleLock, EC);
+    ASSERT_FALSE(EC);
+    Out << Hostname << " 2147483646";
+  }
+
+  EXPECT_FALSE(LockFileManager::isLocked(StaleFile));
+  EXPECT_FALSE(sys::fs::exists(StaleLock.str()));
+  EXPECT_TRUE(LockFileManager::isLocked(LiveFile));
+}
+
 } // end anonymous namespace
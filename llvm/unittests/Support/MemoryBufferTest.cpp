@@ -435,6 +435,41 @@ TEST_F(MemoryBufferTest, mmapVolatileNoNull) {
   EXPECT_TRUE(MB->getBuffer().starts_with("01234567"));
 }
 
+TEST_F(MemoryBufferTest, adviseIfMmap) {
+  int FD;
+  SmallString<64> TestPath;
+  ASSERT_NO_ERROR(sys::fs::createTemporaryFile("MemoryBufferTest_adviseIfMmap",
+                                               "temp", FD, TestPath));
+  FileRemover Cleanup(TestPath);
+  raw_fd_ostream OF(FD, true);
+  unsigned PageSize = sys::Process::getPageSizeEstimate();
+  unsigned FileWrites = (PageSize * 8) / 8;
+  for (unsigned i = 0; i < FileWrites; ++i)
+    OF << "01234567";
+  OF.close();
+
+  ErrorOr<OwningBuffer> MB = MemoryBuffer::getFile(
+      TestPath, /*IsText=*/false, /*RequiresNullTerminator=*/false);
+  ASSERT_NO_ERROR(MB.getError());
+  ASSERT_EQ((*MB)->getBufferKind(), MemoryBuffer::MemoryBuffer_MMap);
+
+  // Hints must not change the contents of the buffer.
+  for (sys::fs::access_hint Hint :
+       {sys::fs::access_hint::sequential, sys::fs::access_hint::random,
+        sys::fs::access_hint::will_need, sys::fs::access_hint::huge_pages,
+        sys::fs::access_hint::normal}) {
+    (*MB)->adviseIfMmap(Hint);
+    EXPECT_EQ((*MB)->getBufferSize(), std::size_t(FileWrites * 8));
+    EXPECT_TRUE((*MB)->getBuffer().starts_with("01234567"));
+    EXPECT_TRUE((*MB)->getBuffer().ends_with("01234567"));
+  }
+
+  // Buffers that are not file mappings ignore hints.
+  OwningBuffer Copy = MemoryBuffer::getMemBufferCopy((*MB)->getBuffer());
+  Copy->adviseIfMmap(sys::fs::access_hint::will_need);
+  EXPECT_EQ(Copy->getBuffer(), (*MB)->getBuffer());
+}
+
 // Test that SmallVector without a null terminator gets one.
 TEST(SmallVectorMemoryBufferTest, WithoutNullTerminatorRequiresNullTerminator) {
   SmallString<0> Data("some data");
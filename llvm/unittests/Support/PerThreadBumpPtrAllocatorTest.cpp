@@ -9,6 +9,7 @@
 #include "llvm/Support/PerThreadBumpPtrAllocator.h"
 #include "llvm/Support/Parallel.h"
 #include "gtest/gtest.h"
+#include <atomic>
 #include <cstdlib>
 
 using namespace llvm;
@@ -38,6 +39,21 @@ TEST(PerThreadBumpPtrAllocatorTest, Simple) {
   });
 }
 
+TEST(PerThreadBumpPtrAllocatorTest, CacheLineAligned) {
+  PerThreadBumpPtrAllocator Allocator;
+
+  parallel::TaskGroup tg;
+
+  tg.spawn([&]() {
+    uintptr_t Addr = reinterpret_cast<uintptr_t>(
+        &Allocator.getThreadLocalAllocator());
+    EXPECT_EQ(0u, Addr % 64);
+  });
+  using PaddedAllocator =
+      parallel::detail::CacheLineAlignedAllocator<BumpPtrAllocator>;
+  EXPECT_EQ(0u, sizeof(PaddedAllocator) % 64);
+}
+
 TEST(PerThreadBumpPtrAllocatorTest, ParallelAllocation) {
   PerThreadBumpPtrAllocator Allocator;
 
@@ -53,4 +69,47 @@ TEST(PerThreadBumpPtrAllocatorTest, ParallelAllocation) {
   EXPECT_EQ(Allocator.getNumberOfAllocators(), parallel::getThreadCount());
 }
 
+TEST(PerThreadBumpPtrAllocatorTest, PooledSlabs) {
+  SlabPool Pool;
+  {
+    PooledPerThreadBumpPtrAllocator Allocator(Pool);
+    parallelFor(0, 1000, [&](size_t Idx) {
+      uint64_t *Ptr = Allocator.Allocate<uint64_t>(64);
+      Ptr[63] = Idx;
+    });
+    EXPECT_EQ(sizeof(uint64_t) * 64 * 1000, Allocator.getBytesAllocated());
+    EXPECT_EQ(0u, Pool.getCachedMemory());
+
+    // Reset() keeps one slab per thread and returns the rest to the pool.
+    size_t TotalMemory = Allocator.getTotalMemory();
+    Allocator.Reset();
+    EXPECT_EQ(TotalMemory - Allocator.getTotalMemory(), Pool.getCachedMemory());
+  }
+  // All slabs are back in the pool once the allocator is gone and can be
+  // reused by another one.
+  size_t Cached = Pool.getCachedMemory();
+  EXPECT_NE(0u, Cached);
+  PooledPerThreadBumpPtrAllocator Allocator(Pool);
+  parallelFor(0, 10, [&](size_t) { Allocator.Allocate<uint64_t>(1); });
+  EXPECT_EQ(Cached, Pool.getCachedMemory() + Allocator.getTotalMemory());
+
+  Pool.releaseMemory();
+  EXPECT_EQ(0u, Pool.getCachedMemory());
+}
+
+TEST(PerThreadBumpPtrAllocatorTest, SpecificAllocator) {
+  static std::atomic<size_t> NumDestroyed;
+  struct Counted {
+    ~Counted() { ++NumDestroyed; }
+    size_t Value;
+  };
+
+  NumDestroyed = 0;
+  PerThreadSpecificBumpPtrAllocator<Counted> Allocator;
+  parallelFor(0, 1000,
+              [&](size_t Idx) { new (Allocator.Allocate()) Counted{Idx}; });
+  Allocator.DestroyAll();
+  EXPECT_EQ(1000u, NumDestroyed);
+}
+
 } // anonymous namespace
@@ -0,0 +1,83 @@
+//===- unittests/Support/SuffixArrayTest.cpp - suffix array tests ---------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#include "llvm/Support/SuffixArray.h"
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <random>
+#include <vector>
+
+using namespace llvm;
+
+namespace {
+
+using Repeat = std::pair<unsigned, std::vector<unsigned>>;
+
+template <typename ContainerT>
+static std::vector<Repeat> collectRepeats(ContainerT &C) {
+  std::vector<Repeat> Repeats;
+  for (SuffixTree::RepeatedSubstring &RS : C) {
+    std::vector<unsigned> Starts(RS.StartIndices.begin(),
+                                 RS.StartIndices.end());
+    llvm::sort(Starts);
+    Repeats.push_back({RS.Length, Starts});
+  }
+  llvm::sort(Repeats);
+  return Repeats;
+}
+
+// Tests that the SuffixArray finds {1, 2} twice in the provided string.
+TEST(SuffixArrayTest, TestSingleRepetition) {
+  std::vector<unsigned> SimpleRepetitionData = {1, 2, 1, 2, 3};
+  SuffixArray SA(SimpleRepetitionData);
+  std::vector<Repeat> Repeats = collectRepeats(SA);
+  ASSERT_EQ(Repeats.size(), 1u);
+  EXPECT_EQ(Repeats[0].first, 2u);
+  EXPECT_EQ(Repeats[0].second, std::vector<unsigned>({0, 2}));
+}
+
+// Unlike the SuffixTree, the SuffixArray finds tandem repeats in a string
+// without a unique terminator.
+TEST(SuffixArrayTest, TestTandemRepeat) {
+  std::vector<unsigned> RepeatedRepetitionData = {1, 2, 3, 1, 2, 3};
+  SuffixArray SA(RepeatedRepetitionData);
+  std::vector<Repeat> Repeats = collectRepeats(SA);
+  ASSERT_EQ(Repeats.size(), 2u);
+  EXPECT_EQ(Repeats[0], Repeat(2, {1, 4}));
+  EXPECT_EQ(Repeats[1], Repeat(3, {0, 3}));
+}
+
+// Tests that the SuffixArray handles elements which use the full range of
+// unsigned, like the outliner's illegal instruction numbers.
+TEST(SuffixArrayTest, TestLargeElements) {
+  std::vector<unsigned> Data = {-1u, -2u, 5, -1u, -2u, 5, -3u};
+  SuffixArray SA(Data);
+  std::vector<Repeat> Repeats = collectRepeats(SA);
+  ASSERT_EQ(Repeats.size(), 2u);
+  EXPECT_EQ(Repeats[0], Repeat(2, {1, 4}));
+  EXPECT_EQ(Repeats[1], Repeat(3, {0, 3}));
+}
+
+// Tests that the SuffixArray finds the same repeated substrings as the
+// SuffixTree on strings that end in a unique element.
+TEST(SuffixArrayTest, TestMatchesSuffixTree) {
+  std::mt19937 Rng(5);
+  for (unsigned Alphabet : {2u, 3u, 8u}) {
+    for (unsigned Iter = 0; Iter < 20; ++Iter) {
+      std::vector<unsigned> Data(1 + Rng() % 300);
+      for (unsigned &Elt : Data)
+        Elt = Rng() % Alphabet;
+      Data.push_back(Alphabet);
+      SuffixTree ST(Data);
+      SuffixArray SA(Data);
+      EXPECT_EQ(collectRepeats(ST), collectRepeats(SA));
+    }
+  }
+}
+
+} // namespace
@@ -15,6 +15,7 @@
 //===----------------------------------------------------------------------===//
 
 #include "llvm/Support/TimeProfiler.h"
+#include "llvm/Support/raw_ostream.h"
 #include "gtest/gtest.h"
 
 using namespace llvm;
@@ -65,6 +66,38 @@ TEST(TimeProfiler, Async_Begin_End_Smoke) {
   ASSERT_TRUE(json.find(R"("detail":"detail")") != std::string::npos);
 }
 
+TEST(TimeProfiler, Summary_Smoke) {
+  timeTraceProfilerInitialize(/*TimeTraceGranularity=*/0, "test",
+                              TimeTraceProfilerMode::Summary);
+
+  bool DetailComputed = false;
+  {
+    TimeTraceScope Outer("outer");
+    for (int I = 0; I < 3; ++I) {
+      TimeTraceScope Inner("inner", [&] {
+        DetailComputed = true;
+        return std::string("detail");
+      });
+    }
+  }
+  { TimeTraceScope Inner("inner"); }
+
+  std::string Summary;
+  raw_string_ostream OS(Summary);
+  timeTraceProfilerWriteSummary(OS);
+  std::string json = teardownProfiler();
+
+  // Details and individual events are not recorded.
+  EXPECT_FALSE(DetailComputed);
+  EXPECT_EQ(json.find(R"("name":"inner")"), std::string::npos);
+  EXPECT_NE(json.find(R"("name":"Total inner")"), std::string::npos);
+
+  // "inner" nested in "outer" and at the top level are separate nodes.
+  EXPECT_NE(Summary.find("          1  outer\n"), std::string::npos);
+  EXPECT_NE(Summary.find("          3    inner\n"), std::string::npos);
+  EXPECT_NE(Summary.find("          1  inner\n"), std::string::npos);
+}
+
 TEST(TimeProfiler, Begin_End_Disabled) {
   // Nothing should be observable here. The test is really just making sure
   // we've not got a stray nullptr deref.
@@ -574,4 +574,47 @@ TEST(raw_ostreamTest, writeToStdOut) {
   EXPECT_EQ(CapturedStdOut, "HelloWorld");
 }
 
+TEST(raw_ostreamTest, mmapStream) {
+  llvm::unittest::TempDir RootTestDirectory("mmapStream", /*Unique*/ true);
+  SmallString<128> Path(RootTestDirectory.path());
+  sys::path::append(Path, "test.txt");
+
+  // Write past the initial size of the mapping, both through the buffer and
+  // with large unbuffered writes, and patch the start with pwrite.
+  std::string Golden;
+  raw_string_ostream GoldenOS(Golden);
+  auto Write = [](raw_ostream &OS) {
+    OS << "HEADER";
+    for (unsigned I = 0; I < 200000; ++I)
+      OS << I << ' ';
+    OS << std::string(3 << 20, 'a') << "TAIL";
+  };
+  {
+    Expected<std::unique_ptr<raw_mmap_ostream>> OSOrErr =
+        raw_mmap_ostream::create(Path, /*SizeHint=*/100);
+    ASSERT_THAT_EXPECTED(OSOrErr, Succeeded());
+    raw_mmap_ostream &OS = **OSOrErr;
+    Write(OS);
+    Write(GoldenOS);
+    OS.pwrite("header", 6, 0);
+    Golden.replace(0, 6, "header");
+    EXPECT_EQ(OS.tell(), Golden.size());
+    ASSERT_THAT_ERROR(OS.commit(), Succeeded());
+    EXPECT_FALSE(OS.error());
+  }
+  checkFileData(Path, Golden);
+
+  // The output file is not replaced if the stream is not committed.
+  {
+    Expected<std::unique_ptr<raw_mmap_ostream>> OSOrErr =
+        raw_mmap_ostream::create(Path);
+    ASSERT_THAT_EXPECTED(OSOrErr, Succeeded());
+    **OSOrErr << "data";
+  }
+  checkFileData(Path, Golden);
+
+  // Special files are not memory-mapped.
+  EXPECT_THAT_EXPECTED(raw_mmap_ostream::create("-"), Failed());
+}
+
 } // namespace
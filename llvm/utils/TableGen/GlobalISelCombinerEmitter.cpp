@@ -2487,6 +2487,13 @@ GICombinerEmitter::GICombinerEmitter(RecordKeeper &RK,
                                      StringRef Name, Record *Combiner)
     : Records(RK), Name(Name), Target(Target), Combiner(Combiner) {}
 
+/// Build one match table for every rule of the combiner.
+///
+/// Rules are grouped by the opcode of their root and the groups are put
+/// behind a SwitchMatcher, so the generated table starts with a
+/// GIM_SwitchOpcode and an instruction is only checked against the rules
+/// rooted at its opcode. Within a group, rules sharing their first predicates
+/// are merged by GroupMatcher so the shared checks run once.
 MatchTable
 GICombinerEmitter::buildMatchTable(MutableArrayRef<RuleMatcher> Rules) {
   std::vector<Matcher *> InputRules;
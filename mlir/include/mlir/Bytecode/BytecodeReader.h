@@ -88,6 +88,12 @@ LogicalResult readBytecodeFile(llvm::MemoryBufferRef buffer, Block *block,
 /// An overload with a source manager whose main file buffer is used for
 /// parsing. The lifetime of the source manager may be freely extended during
 /// parsing such that the source manager is not destroyed before the parsed IR.
+///
+/// Because the buffer outlives the IR, resource blobs are referenced in place
+/// instead of being copied, so large blobs cost no more than the pages that
+/// are touched when the buffer is memory mapped. The buffer must be aligned to
+/// the largest blob alignment, e.g. by opening it with
+/// `openInputFile(filename, alignment)`, or reading an aligned blob fails.
 LogicalResult
 readBytecodeFile(const std::shared_ptr<llvm::SourceMgr> &sourceMgr,
                  Block *block, const ParserConfig &config);
@@ -234,6 +234,12 @@ struct SCFTileAndFuseResult {
 ///   %4 = linalg.matmul .. outs(%3 : ...)
 /// }
 /// ```
+///
+/// Each call tiles for one level of the memory hierarchy. Tiling for several
+/// cache levels is done by calling this again on the tiled consumer, i.e. the
+/// first of `tiledAndFusedOps`, with the tile sizes of the next inner level.
+/// The tile sizes themselves are left to the caller; nothing here models the
+/// target's caches.
 FailureOr<SCFTileAndFuseResult>
 tileConsumerAndFuseProducersUsingSCF(RewriterBase &rewriter,
                                      TilingInterface consumer,
@@ -121,6 +121,12 @@ private:
 /// will be executed following the internal logic of the operation. It must
 /// have the `PossibleTopLevelTransformOp` trait and not have any operands.
 /// This function internally keeps track of the transformation state.
+///
+/// `extraMapping` is bound to the block arguments of `transform` that follow
+/// the payload root, so it can carry parameters such as tile sizes. A driver
+/// that searches over schedules can thus parse the transform script once and
+/// apply it to clones of the payload with different parameters, instead of
+/// rewriting the script.
 LogicalResult
 applyTransforms(Operation *payloadRoot, TransformOpInterface transform,
                 const RaggedArray<MappedValue> &extraMapping = {},
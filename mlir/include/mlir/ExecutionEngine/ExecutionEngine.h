@@ -18,6 +18,7 @@
 #include "llvm/ExecutionEngine/Orc/LLJIT.h"
 #include "llvm/ExecutionEngine/SectionMemoryManager.h"
 #include "llvm/IR/LLVMContext.h"
+#include "llvm/Support/CachePruning.h"
 #include "llvm/Support/Error.h"
 
 #include <functional>
@@ -50,10 +51,40 @@ public:
   /// Returns `true` if cache hasn't been populated yet.
   bool isEmpty();
 
-private:
+protected:
   llvm::StringMap<std::unique_ptr<llvm::MemoryBuffer>> cachedObjects;
 };
 
+/// An object cache that also keeps the objects in a directory on disk, so that
+/// identical modules compiled for the same target by a later process are
+/// loaded instead of being compiled again. Objects are keyed by a hash of the
+/// textual LLVM IR of the module and of `targetKey`, which must identify
+/// everything else that affects code generation (e.g. the target triple, CPU,
+/// features and optimization level).
+class PersistentObjectCache : public SimpleObjectCache {
+public:
+  PersistentObjectCache(StringRef directory, StringRef targetKey,
+                        llvm::CachePruningPolicy policy)
+      : directory(directory), targetKey(targetKey), policy(policy) {}
+
+  void notifyObjectCompiled(const llvm::Module *m,
+                            llvm::MemoryBufferRef objBuffer) override;
+  std::unique_ptr<llvm::MemoryBuffer> getObject(const llvm::Module *m) override;
+
+private:
+  /// Returns the path of the cache entry for the module `m`.
+  std::string getCachePath(const llvm::Module *m);
+
+  std::string directory;
+  std::string targetKey;
+  llvm::CachePruningPolicy policy;
+
+  /// The cache paths computed in `getObject`, for modules that are being
+  /// compiled. Code generation may change the module, so the path must not be
+  /// recomputed once the object is compiled.
+  llvm::DenseMap<const llvm::Module *, std::string> pendingPaths;
+};
+
 struct ExecutionEngineOptions {
   /// If `llvmModuleBuilder` is provided, it will be used to create an LLVM
   /// module from the given MLIR IR. Otherwise, a default
@@ -92,6 +123,14 @@ struct ExecutionEngineOptions {
   /// be dumped to a file via the `dumpToObjectFile` method.
   bool enableObjectDump = false;
 
+  /// If `objectCacheDirectory` is set, the object generated for the given
+  /// module is also stored in that directory, and an object stored there for
+  /// an identical module and target is used instead of compiling it again.
+  /// The directory is pruned according to `objectCachePruningPolicy` whenever
+  /// a new object is added to it.
+  StringRef objectCacheDirectory;
+  llvm::CachePruningPolicy objectCachePruningPolicy;
+
   /// If enable `enableGDBNotificationListener` is set, the JIT compiler will
   /// notify the llvm's global GDB notification listener.
   bool enableGDBNotificationListener = true;
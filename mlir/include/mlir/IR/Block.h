@@ -32,6 +32,11 @@ public:
   explicit Block() = default;
   ~Block();
 
+  /// Erase all operations in this block.
+  ///
+  /// This still unlinks every operand from its use list one at a time, even
+  /// when the value is defined in this block too: a value may be used from
+  /// outside the block, so its use list can't be dropped wholesale.
   void clear() {
     // Drop all references from within this block.
     dropAllReferences();
@@ -46,6 +46,14 @@ public:
 
   /// Invalidate dominance info. This can be used by clients that make major
   /// changes to the CFG and don't have a good way to update it.
+  ///
+  /// Only changes to the blocks of a region and the edges between them need
+  /// this. Dominance between operations of one block is answered from the
+  /// block's operation order, which is kept up to date as operations are
+  /// inserted, moved or erased, so rewrites that leave the CFG alone can keep
+  /// using this analysis. The tree of a region is only built when it is first
+  /// queried, so invalidating just the changed region is cheaper than
+  /// invalidating everything.
   void invalidate();
   void invalidate(Region *region);
 
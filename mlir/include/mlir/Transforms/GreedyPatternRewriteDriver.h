@@ -51,6 +51,13 @@ public:
   /// between applying patterns and simplifying regions. Use `kNoLimit` to
   /// disable this iteration limit.
   ///
+  /// Every iteration re-seeds the worklist with all ops in the region, and a
+  /// region that changed at all takes at least one more iteration to confirm
+  /// the fixpoint. Callers that know which ops changed should prefer
+  /// `applyOpPatternsAndFold`, which only visits those ops and their users
+  /// and producers. The time spent in each pattern can be measured with
+  /// `--profile-actions-to`, which records every `ApplyPatternAction`.
+  ///
   /// Note: Only applicable when simplifying entire regions.
   int64_t maxIterations = 10;
 
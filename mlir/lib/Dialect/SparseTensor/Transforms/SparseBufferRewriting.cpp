@@ -9,6 +9,12 @@
 // This file implements rewriting rules that are specific to sparse tensor
 // primitives with memref operands.
 //
+// The sort and search primitives are lowered to sequential code in private
+// functions that are emitted once per element type and comparison arity. The
+// compare-and-swap structure of these sorts has no independent iterations, so
+// a parallel lowering would need a different algorithm (e.g. a radix sort over
+// a prefix sum) rather than an scf.parallel around the loops emitted here.
+//
 //===----------------------------------------------------------------------===//
 
 #include "Utils/CodegenUtils.h"
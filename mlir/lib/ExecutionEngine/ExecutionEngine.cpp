@@ -24,10 +24,14 @@
 #include "llvm/ExecutionEngine/Orc/IRTransformLayer.h"
 #include "llvm/ExecutionEngine/Orc/JITTargetMachineBuilder.h"
 #include "llvm/ExecutionEngine/Orc/RTDyldObjectLinkingLayer.h"
+#include "llvm/ADT/StringExtras.h"
 #include "llvm/IR/IRBuilder.h"
 #include "llvm/MC/TargetRegistry.h"
 #include "llvm/Support/Debug.h"
 #include "llvm/Support/Error.h"
+#include "llvm/Support/FileSystem.h"
+#include "llvm/Support/Path.h"
+#include "llvm/Support/SHA1.h"
 #include "llvm/Support/ToolOutputFile.h"
 #include "llvm/TargetParser/Host.h"
 #include "llvm/TargetParser/SubtargetFeature.h"
@@ -98,6 +102,76 @@ void SimpleObjectCache::dumpToObjectFile(StringRef outputFilename) {
 
 bool SimpleObjectCache::isEmpty() { return cachedObjects.empty(); }
 
+std::string PersistentObjectCache::getCachePath(const Module *m) {
+  std::string moduleText;
+  llvm::raw_string_ostream os(moduleText);
+  m->print(os, /*AAW=*/nullptr);
+
+  llvm::SHA1 hasher;
+  hasher.update(targetKey);
+  hasher.update(os.str());
+
+  // Entries must start with "llvmcache-" to be considered by `pruneCache`.
+  SmallString<128> path(directory);
+  llvm::sys::path::append(path, "llvmcache-" + llvm::toHex(hasher.final()));
+  return std::string(path);
+}
+
+std::unique_ptr<MemoryBuffer>
+PersistentObjectCache::getObject(const Module *m) {
+  if (std::unique_ptr<MemoryBuffer> object = SimpleObjectCache::getObject(m))
+    return object;
+
+  std::string path = getCachePath(m);
+  auto bufferOrErr = MemoryBuffer::getFile(path, /*IsText=*/false,
+                                           /*RequiresNullTerminator=*/false);
+  if (!bufferOrErr) {
+    LLVM_DEBUG(dbgs() << "No object for " << m->getModuleIdentifier()
+                      << " in " << path << ". Compiling.\n");
+    pendingPaths[m] = std::move(path);
+    return nullptr;
+  }
+  LLVM_DEBUG(dbgs() << "Object for " << m->getModuleIdentifier()
+                    << " loaded from " << path << ".\n");
+
+  // Keep the object in memory too, so that it can still be dumped.
+  std::unique_ptr<MemoryBuffer> &cached =
+      cachedObjects[m->getModuleIdentifier()];
+  cached = std::move(*bufferOrErr);
+  return MemoryBuffer::getMemBuffer(cached->getMemBufferRef());
+}
+
+void PersistentObjectCache::notifyObjectCompiled(const Module *m,
+                                                 MemoryBufferRef objBuffer) {
+  SimpleObjectCache::notifyObjectCompiled(m, objBuffer);
+
+  auto it = pendingPaths.find(m);
+  if (it == pendingPaths.end())
+    return;
+  std::string path = std::move(it->second);
+  pendingPaths.erase(it);
+
+  // Failing to write the cache entry only costs a compilation next time, so
+  // report it in debug output and carry on.
+  if (std::error_code ec = llvm::sys::fs::create_directories(directory)) {
+    LLVM_DEBUG(dbgs() << "Could not create object cache directory "
+                      << directory << ": " << ec.message() << "\n");
+    return;
+  }
+  // Write through a temporary file so that concurrent processes never see a
+  // partially written entry.
+  if (Error error = llvm::writeToOutput(path, [&](llvm::raw_ostream &os) {
+        os << objBuffer.getBuffer();
+        return Error::success();
+      })) {
+    LLVM_DEBUG(dbgs() << "Could not write object cache entry " << path << ": "
+                      << error << "\n");
+    llvm::consumeError(std::move(error));
+    return;
+  }
+  llvm::pruneCache(directory, policy);
+}
+
 void ExecutionEngine::dumpToObjectFile(StringRef filename) {
   if (cache == nullptr) {
     llvm::errs() << "cannot dump ExecutionEngine object code to file: "
@@ -272,6 +346,20 @@ ExecutionEngine::create(Operation *m, const ExecutionEngineOptions &options,
   setupTargetTripleAndDataLayout(llvmModule.get(), tm.get());
   packFunctionArguments(llvmModule.get());
 
+  // The persistent cache also keeps the objects in memory, so it serves object
+  // dumping as well.
+  if (!options.objectCacheDirectory.empty()) {
+    std::string targetKey;
+    llvm::raw_string_ostream os(targetKey);
+    os << tm->getTargetTriple().str() << ';' << tm->getTargetCPU() << ';'
+       << tm->getTargetFeatureString() << ';'
+       << static_cast<int>(
+              options.jitCodeGenOptLevel.value_or(tm->getOptLevel()));
+    engine->cache = std::make_unique<PersistentObjectCache>(
+        options.objectCacheDirectory, os.str(),
+        options.objectCachePruningPolicy);
+  }
+
   auto dataLayout = llvmModule->getDataLayout();
 
   // Use absolute library path so that gdb can find the symbol table.
@@ -775,6 +775,14 @@ void OpToOpPassAdaptor::runOnOperationAsyncImpl(bool verifyPasses) {
   // Run a prepass over the operation to collect the nested operations to
   // execute over. This ensures that an analysis manager exists for each
   // operation, as well as providing a queue of operations to execute over.
+  //
+  // Only operations that are isolated from above ever get here, as passes may
+  // only be scheduled on those. That is what makes running them concurrently
+  // safe: a pass on one operation can't read or rewrite the SSA values, use
+  // lists or parent blocks that a pass on a sibling operation may be changing.
+  // Regions that are not isolated, like the bodies of loops within a single
+  // function, share all of that state with their parent, so their passes run
+  // on the thread that owns the parent.
   std::vector<OpPMInfo> opInfos;
   DenseMap<OperationName, std::optional<unsigned>> knownOpPMIdx;
   for (auto &region : getOperation()->getRegions()) {
@@ -25,6 +25,8 @@
 #include "mlir/Target/LLVMIR/Dialect/Builtin/BuiltinToLLVMIRTranslation.h"
 #include "mlir/Target/LLVMIR/Dialect/LLVMIR/LLVMToLLVMIRTranslation.h"
 #include "mlir/Target/LLVMIR/Export.h"
+#include "llvm/Support/FileSystem.h"
+#include "llvm/Support/Path.h"
 #include "llvm/Support/TargetSelect.h"
 #include "llvm/Support/raw_ostream.h"
 
@@ -114,6 +116,57 @@ TEST(MLIRExecutionEngine, SKIP_WITHOUT_JIT(SubtractFloat)) {
   ASSERT_EQ(result, 42.f);
 }
 
+TEST(MLIRExecutionEngine, SKIP_WITHOUT_JIT(PersistentObjectCache)) {
+  std::string moduleStr = R"mlir(
+  func.func @foo(%arg0 : i32) -> i32 attributes { llvm.emit_c_interface } {
+    %res = arith.muli %arg0, %arg0 : i32
+    return %res : i32
+  }
+  )mlir";
+  DialectRegistry registry;
+  registerAllDialects(registry);
+  registerBuiltinDialectTranslation(registry);
+  registerLLVMDialectTranslation(registry);
+  MLIRContext context(registry);
+  OwningOpRef<ModuleOp> module =
+      parseSourceString<ModuleOp>(moduleStr, &context);
+  ASSERT_TRUE(!!module);
+  ASSERT_TRUE(succeeded(lowerToLLVMDialect(*module)));
+
+  SmallString<128> cacheDir;
+  ASSERT_FALSE(
+      llvm::sys::fs::createUniqueDirectory("mlir-object-cache", cacheDir));
+  ExecutionEngineOptions options;
+  options.objectCacheDirectory = cacheDir;
+
+  // Count the cache entries, which excludes the pruning timestamp file.
+  auto countEntries = [&]() {
+    unsigned numEntries = 0;
+    std::error_code ec;
+    for (llvm::sys::fs::directory_iterator it(cacheDir, ec), end;
+         !ec && it != end; it.increment(ec))
+      if (llvm::sys::path::filename(it->path()).starts_with("llvmcache-"))
+        ++numEntries;
+    return numEntries;
+  };
+
+  // The first engine compiles the module and stores the object, the second
+  // one finds it in the cache. Both must compute the same result.
+  for (unsigned i = 0; i < 2; ++i) {
+    auto jitOrError = ExecutionEngine::create(*module, options);
+    ASSERT_TRUE(!!jitOrError);
+    std::unique_ptr<ExecutionEngine> jit = std::move(jitOrError.get());
+    int result = 0;
+    llvm::Error error =
+        jit->invoke("foo", 7, ExecutionEngine::Result<int>(result));
+    ASSERT_TRUE(!error);
+    ASSERT_EQ(result, 7 * 7);
+    ASSERT_EQ(countEntries(), 1u);
+  }
+
+  llvm::sys::fs::remove_directories(cacheDir);
+}
+
 TEST(NativeMemRefJit, SKIP_WITHOUT_JIT(ZeroRankMemref)) {
   OwningMemRef<float, 0> a({});
   a[{}] = 42.;
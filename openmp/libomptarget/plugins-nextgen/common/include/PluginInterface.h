@@ -524,6 +524,11 @@ public:
     //              Failure to lock the buffers are silent.
     //   mandatory: Mapped host buffers are always locked and failures to lock
     //              a buffer results in a fatal error.
+    // Transfers from and to locked buffers can be done asynchronously by the
+    // device without going through pageable memory. Plugins that need pinned
+    // memory for other transfers, such as AMDGPU, stage them through a pool of
+    // pinned buffers instead, so locking mostly pays off for large mappings
+    // that are transferred repeatedly.
     StringEnvar OMPX_LockMappedBuffers("LIBOMPTARGET_LOCK_MAPPED_HOST_BUFFERS",
                                        "off");
 
@@ -82,6 +82,11 @@ kmp_uint32 __kmp_barrier_gather_bb_dflt = 2;
 kmp_uint32 __kmp_barrier_release_bb_dflt = 2;
 /* branch_factor = 4 */ /* hyper2: C78980 */
 
+// The hyper barrier is the default because it does not depend on thread
+// placement. With threads bound through KMP_AFFINITY or OMP_PROC_BIND, the
+// "hierarchical" pattern builds its tree from the machine hierarchy that
+// affinity discovers (see __kmp_get_hierarchy), and the "dist" pattern
+// suits wide teams; both can be selected with KMP_*_BARRIER_PATTERN.
 kmp_bar_pat_e __kmp_barrier_gather_pat_dflt = bp_hyper_bar;
 /* hyper2: C78980 */
 kmp_bar_pat_e __kmp_barrier_release_pat_dflt = bp_hyper_bar;
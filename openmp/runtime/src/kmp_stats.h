@@ -821,6 +821,12 @@ public:
                        events
    KMP_STATS_EVENTS_FILE -- if set, all events are outputted to this file,
                             otherwise, output is sent to "events.dat"
+
+   Events are recorded per thread with start and stop timestamps, so the
+   events file is effectively a timeline of parallel regions, barriers, tasks
+   and idle time (OMP_idle) for every thread. The timers that feed it sit on
+   the runtime's hot paths, which is why all of this is only compiled in with
+   LIBOMP_STATS rather than being enabled at run time.
 **************************************************************** */
 class kmp_stats_output_module {
 
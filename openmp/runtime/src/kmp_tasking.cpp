@@ -3219,6 +3219,11 @@ static kmp_task_t *__kmp_remove_my_task(kmp_info_t *thread, kmp_int32 gtid,
 // __kmp_steal_task: remove a task from another thread's deque
 // Assume that calling thread has already checked existence of
 // task_team thread_data before calling this routine.
+// The victim's deque lock is only taken once an unlocked read of its task
+// count finds work, so failed steal attempts on empty deques stay cheap. The
+// lock is kept, rather than a lock-free deque, because a thief may have to
+// skip tasks that __kmp_task_is_allowed rejects and remove one from the
+// middle of the deque, shifting the rest.
 static kmp_task_t *__kmp_steal_task(kmp_int32 victim_tid, kmp_int32 gtid,
                                     kmp_task_team_t *task_team,
                                     std::atomic<kmp_int32> *unfinished_threads,
@@ -869,6 +869,11 @@ static void runIslScheduleOptimizer(
     SC = SC.set_validity(Validity);
     SC = SC.set_coincidence(Validity);
 
+    // The whole rescheduling attempt is bounded by -polly-schedule-computeout.
+    // If the quota runs out, the SCoP keeps its original schedule and none of
+    // the post-rescheduling optimizations below are applied. Nothing is cached
+    // between compiles, so a SCoP that exceeds the quota pays for it on every
+    // build.
     {
       IslMaxOperationsGuard MaxOpGuard(Ctx, ScheduleComputeOut);
       Schedule = SC.compute_schedule();